@@ -0,0 +1,245 @@
+#include "ChaosCounter.h"
+#include "ChaosEngine.h"
+#include "ChaosExceptions.h"
+
+#pragma managed(push, off)
+#include "../Native/ChaosCore.h"
+#pragma managed(pop)
+
+using namespace System;
+using namespace System::Diagnostics::Contracts;
+
+namespace Aurora
+{
+	ChaosCounter::ChaosCounter()
+	{
+		String^ stored;
+		_key = ChaosEngine::ParseSeed(nullptr, stored);
+		_seed = stored;
+	}
+
+	ChaosCounter::ChaosCounter(String^ seed)
+	{
+		String^ stored;
+		_key = ChaosEngine::ParseSeed(seed, stored);
+		_seed = stored;
+	}
+
+	ChaosCounter::ChaosCounter(int seed)
+	{
+		_key = seed;
+		_seed = seed.ToString();
+	}
+
+	String^ ChaosCounter::Seed::get()
+	{
+		return _seed;
+	}
+
+	long long ChaosCounter::Position::get()
+	{
+		return _position;
+	}
+
+	void ChaosCounter::Position::set(long long value)
+	{
+		if (value < 0)
+		{
+			ThrowTooLowExceptionZero("value");
+		}
+
+		Contract::EndContractBlock();
+
+		_position = value;
+	}
+
+	int ChaosCounter::ValueAt(long long index)
+	{
+		if (index < 0)
+		{
+			ThrowTooLowExceptionZero("index");
+		}
+
+		Contract::EndContractBlock();
+
+		return Native::ChaosCounterCore(_key).SampleAt(static_cast<unsigned long long>(index));
+	}
+
+	void ChaosCounter::Fill(long long startIndex, array<int>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> pinned = &buffer[0];
+		Fill(startIndex, pinned, buffer->Length);
+	}
+
+	void ChaosCounter::Fill(long long startIndex, int* buffer, int length)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (startIndex < 0)
+		{
+			ThrowTooLowExceptionZero("startIndex");
+		}
+
+		Contract::EndContractBlock();
+
+		Native::ChaosCounterCore(_key).Fill(static_cast<unsigned long long>(startIndex), buffer, length);
+	}
+
+	bool ChaosCounter::NextBoolean()
+	{
+		return Native::ScaleSample(NextSample(), 0, 2) == 1;
+	}
+
+	bool ChaosCounter::NextProbability(float percent)
+	{
+		int sample = NextSample();
+		return percent >= 1 || (percent > 0 && Native::SampleToRange(sample, true) < percent);
+	}
+
+	bool ChaosCounter::NextProbability(int percent)
+	{
+		int sample = NextSample();
+		return percent >= 100 || (percent > 0 && Native::ScaleSample(sample, 0, 100) < percent);
+	}
+
+	unsigned char ChaosCounter::NextByte()
+	{
+		return static_cast<unsigned char>(Native::ScaleSample(NextSample(), 0, 256));
+	}
+
+	unsigned char ChaosCounter::NextByte(unsigned char minValue, unsigned char maxValue)
+	{
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		return static_cast<unsigned char>(Native::ScaleSample(NextSample(), minValue, maxValue + 1));
+	}
+
+	int ChaosCounter::NextInteger()
+	{
+		return NextSample();
+	}
+
+	int ChaosCounter::NextInteger(int maxValue)
+	{
+		return NextInteger(0, maxValue);
+	}
+
+	int ChaosCounter::NextInteger(int minValue, int maxValue)
+	{
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		return Native::ScaleSample(NextSample(), minValue, maxValue);
+	}
+
+	float ChaosCounter::NextFloat()
+	{
+		return Native::SampleToRange(NextSample(), true);
+	}
+
+	float ChaosCounter::NextFloat(float minValue, float maxValue)
+	{
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		double range = maxValue - minValue;
+		return Native::SampleToFloat(NextSample(), minValue, range);
+	}
+
+	void ChaosCounter::NextIntegers(array<int>^% buffer, int minValue, int maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> pinned = &buffer[0];
+		NextIntegers(pinned, buffer->Length, minValue, maxValue);
+	}
+
+	void ChaosCounter::NextIntegers(int* buffer, int length, int minValue, int maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		Native::ScaledIntegerConverter converter = { minValue, maxValue };
+		Native::ChaosCounterCore(_key).FillValues<int>(ReservePositions(length), buffer, length, converter);
+	}
+
+	void ChaosCounter::NextFloats(array<float>^% buffer, float minValue, float maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<float> pinned = &buffer[0];
+		NextFloats(pinned, buffer->Length, minValue, maxValue);
+	}
+
+	void ChaosCounter::NextFloats(float* buffer, int length, float minValue, float maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		Native::FloatConverter converter = { minValue, maxValue - minValue };
+		Native::ChaosCounterCore(_key).FillValues<float>(ReservePositions(length), buffer, length, converter);
+	}
+
+	int ChaosCounter::NextSample()
+	{
+		return Native::ChaosCounterCore(_key).SampleAt(static_cast<unsigned long long>(ReservePositions(1)));
+	}
+
+	long long ChaosCounter::ReservePositions(int length)
+	{
+		long long start = _position;
+		_position += length;
+		return start;
+	}
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+namespace Aurora
+{
+	/// <summary>
+	/// Represents a counter based random generator whose values depend only on the seed and their index.
+	/// Any value of the stream can be computed on its own, so work can be split across any number of threads and still produce the same values.
+	/// ValueAt and Fill do not change the counter and can be called from any thread.
+	/// The Next methods read the values at Position and advance it, one index per value, so a counter using them must not be shared between threads.
+	/// The values are not the same as those of a ChaosEngine with the same seed.
+	/// </summary>
+	[System::Serializable]
+	public ref class ChaosCounter sealed
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the ChaosCounter class with a random seed.
+		/// </summary>
+		ChaosCounter();
+
+		/// <summary>
+		/// Initializes a new instance of the ChaosCounter class with the specified seed as a string.
+		/// </summary>
+		/// <param name="seed">The seed value as a string.</param>
+		ChaosCounter(System::String^ seed);
+
+		/// <summary>
+		/// Initializes a new instance of the ChaosCounter class with the specified seed as an integer.
+		/// </summary>
+		/// <param name="seed">The seed value as an integer.</param>
+		ChaosCounter(int seed);
+
+		/// <summary>
+		/// Gets the seed used by the chaos counter.
+		/// </summary>
+		property System::String^ Seed { System::String^ get(); }
+
+		/// <summary>
+		/// Gets or sets the index of the value the next call to a Next method reads.
+		/// </summary>
+		property long long Position { long long get(); void set(long long value); }
+
+		/// <summary>
+		/// Gets the random sample at the specified index.
+		/// </summary>
+		/// <param name="index">The index of the sample.</param>
+		/// <returns>A random sample within the range [0, 2147483647].</returns>
+		int ValueAt(long long index);
+
+		/// <summary>
+		/// Stores the random samples starting at the specified index in the buffer.
+		/// </summary>
+		/// <param name="startIndex">The index of the first sample.</param>
+		/// <param name="buffer">The buffer to store the random samples.</param>
+		void Fill(long long startIndex, array<int>^% buffer);
+
+		/// <summary>
+		/// Stores the random samples starting at the specified index in the buffer.
+		/// </summary>
+		/// <param name="startIndex">The index of the first sample.</param>
+		/// <param name="buffer">A pointer to the buffer to store the random samples.</param>
+		/// <param name="length">The number of samples to store.</param>
+		void Fill(long long startIndex, int* buffer, int length);
+
+		/// <summary>
+		/// Generates the next random boolean value.
+		/// </summary>
+		/// <returns>A random boolean value.</returns>
+		bool NextBoolean();
+
+		/// <summary>
+		/// Generates the next random boolean value with the specified probability of being true.
+		/// </summary>
+		/// <param name="percent">The probability of being true, between 0 and 1.</param>
+		/// <returns>A random boolean value.</returns>
+		bool NextProbability(float percent);
+
+		/// <summary>
+		/// Generates the next random boolean value with the specified probability of being true.
+		/// </summary>
+		/// <param name="percent">The probability of being true, between 0 and 100.</param>
+		/// <returns>A random boolean value.</returns>
+		bool NextProbability(int percent);
+
+		/// <summary>
+		/// Generates the next random byte value.
+		/// </summary>
+		/// <returns>A random byte value.</returns>
+		unsigned char NextByte();
+
+		/// <summary>
+		/// Generates the next random byte value within the specified range.
+		/// </summary>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The maximum value of the range.</param>
+		/// <returns>A random byte value within the specified range.</returns>
+		unsigned char NextByte(unsigned char minValue, unsigned char maxValue);
+
+		/// <summary>
+		/// Generates the next random integer value.
+		/// </summary>
+		/// <returns>A random integer value within the range [0, 2147483647].</returns>
+		int NextInteger();
+
+		/// <summary>
+		/// Generates the next random integer value within the range [0, maxValue).
+		/// </summary>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		/// <returns>A random integer value within the specified range.</returns>
+		int NextInteger(int maxValue);
+
+		/// <summary>
+		/// Generates the next random integer value within the range [minValue, maxValue).
+		/// </summary>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		/// <returns>A random integer value within the specified range.</returns>
+		int NextInteger(int minValue, int maxValue);
+
+		/// <summary>
+		/// Generates the next random float value within the range [0, 1].
+		/// </summary>
+		/// <returns>A random float value.</returns>
+		float NextFloat();
+
+		/// <summary>
+		/// Generates the next random float value within the range [minValue, maxValue].
+		/// </summary>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The maximum value of the range.</param>
+		/// <returns>A random float value within the specified range.</returns>
+		float NextFloat(float minValue, float maxValue);
+
+		/// <summary>
+		/// Generates random integer values within the range [minValue, maxValue) and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random integer values.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextIntegers(array<int>^% buffer, int minValue, int maxValue);
+
+		/// <summary>
+		/// Generates random integer values within the range [minValue, maxValue) and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextIntegers(int* buffer, int length, int minValue, int maxValue);
+
+		/// <summary>
+		/// Generates random float values within the range [minValue, maxValue] and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random float values.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The maximum value of the range.</param>
+		void NextFloats(array<float>^% buffer, float minValue, float maxValue);
+
+		/// <summary>
+		/// Generates random float values within the range [minValue, maxValue] and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random float values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The maximum value of the range.</param>
+		void NextFloats(float* buffer, int length, float minValue, float maxValue);
+
+	private:
+		/// <summary>
+		/// The seed used by the chaos counter.
+		/// </summary>
+		System::String^ _seed;
+
+		/// <summary>
+		/// The parsed seed the values are keyed by.
+		/// </summary>
+		int _key;
+
+		/// <summary>
+		/// The index of the value the next call to a Next method reads.
+		/// </summary>
+		long long _position;
+
+		/// <summary>
+		/// Reads the random sample at the current position and advances the position.
+		/// </summary>
+		/// <returns>A random sample.</returns>
+		int NextSample();
+
+		/// <summary>
+		/// Reserves the specified number of values at the current position.
+		/// </summary>
+		/// <param name="length">The number of values.</param>
+		/// <returns>The index of the first reserved value.</returns>
+		long long ReservePositions(int length);
+	};
+}
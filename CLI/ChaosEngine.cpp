@@ -1,12 +1,19 @@
 #include "ChaosEngine.h"
-#include <limits>
-#include <math.h>
+#include "ChaosExceptions.h"
+#include "ChaosSequence.h"
+
+#pragma managed(push, off)
+#include "../Native/ChaosCore.h"
+#pragma managed(pop)
 
 using namespace System;
 using namespace System::Diagnostics::Contracts;
 using namespace System::Collections::Generic;
 using namespace System::Linq;
+using namespace System::Reflection;
 using namespace System::Threading;
+using namespace System::Threading::Tasks;
+using namespace Aurora::Native;
 
 namespace Aurora
 {
@@ -29,14 +36,326 @@ namespace Aurora
 		throw gcnew ArgumentOutOfRangeException(paramName, message);
 	}
 
+	void ThrowTooHighException(String^ paramName, String^ count)
+	{
+		String^ message = String::Format("'{0}' cannot be greater than {1}.", paramName, count);
+		throw gcnew ArgumentOutOfRangeException(paramName, message);
+	}
+
 	void ThrowTooLowExceptionZero(String^ paramName) { ThrowTooLowException(paramName, "zero"); }
 	void ThrowTooLowExceptionOne(String^ paramName) { ThrowTooLowException(paramName, "one"); }
 
+	void ThrowIndexException(String^ paramName, int count)
+	{
+		String^ message = String::Format("'{0}' must be at least zero and less than {1}.", paramName, count);
+		throw gcnew ArgumentOutOfRangeException(paramName, message);
+	}
+
+	void ThrowWeightException(String^ paramName)
+	{
+		String^ message = String::Format("'{0}' must contain at least one element with a weight greater than zero, and the weights must have a finite sum.", paramName);
+		throw gcnew ArgumentException(message, paramName);
+	}
+
 	void ThrowDivideByZeroException()
 	{
 		throw gcnew DivideByZeroException("Attempting to divide by zero.");
 	}
 
+	void ThrowInvalidStateException(String^ paramName)
+	{
+		String^ message = String::Format("'{0}' does not contain a chaos engine state saved by a supported version.", paramName);
+		throw gcnew ArgumentException(message, paramName);
+	}
+
+	void ThrowEnumWeightException(Type^ enumType)
+	{
+		String^ message = String::Format("'{0}' does not have a value with a weight greater than zero.", enumType->Name);
+		throw gcnew InvalidOperationException(message);
+	}
+
+	/// <summary>
+	/// The number of values in every chunk of a parallel fill except the last.
+	/// It must never change, since it decides which stream fills each value.
+	/// </summary>
+	const int ParallelChunk = 65536;
+
+	/// <summary>
+	/// The largest mean of a Poisson distribution, keeping every value it can draw within the range of an integer.
+	/// </summary>
+	const float MaxPoissonMean = 1e9f;
+
+	template <typename TWeight>
+	int WeightCount(TWeight weight)
+	{
+		return weight > 0 ? static_cast<int>(Math::Ceiling(static_cast<double>(weight))) : 0;
+	}
+
+	int FindWeightedIndex(array<int>^ cumulativeWeights, int index)
+	{
+		pin_ptr<int> pinned = &cumulativeWeights[0];
+		return Native::FindWeightedIndex(pinned, cumulativeWeights->Length, index);
+	}
+
+	/// <summary>
+	/// The values of an enum and their cumulative weights, read from the 'Weighted' attribute of every declared field once per enum type.
+	/// Aliases of the same value are separate fields, so each keeps its own weight.
+	/// </summary>
+	generic <typename T> where T : Enum
+	ref class EnumTable abstract sealed
+	{
+	public:
+		static array<T>^ Values;
+		static array<int>^ CumulativeWeights;
+		static int TotalWeight;
+
+		static EnumTable()
+		{
+			array<FieldInfo^>^ fields = T::typeid->GetFields(BindingFlags::Public | BindingFlags::Static);
+			List<T>^ weightedValues = gcnew List<T>(fields->Length);
+			List<int>^ cumulativeWeights = gcnew List<int>(fields->Length);
+			int totalWeight = 0;
+
+			for each (FieldInfo^ field in fields)
+			{
+				T value = safe_cast<T>(field->GetValue(nullptr));
+				int weight = 1;
+				WeightedAttribute^ attribute = safe_cast<WeightedAttribute^>(Attribute::GetCustomAttribute(field, WeightedAttribute::typeid));
+
+				if (attribute != nullptr)
+					weight = WeightCount(attribute->Weight);
+
+				if (weight > 0)
+				{
+					totalWeight += weight;
+					weightedValues->Add(value);
+					cumulativeWeights->Add(totalWeight);
+				}
+			}
+
+			Values = weightedValues->ToArray();
+			CumulativeWeights = cumulativeWeights->ToArray();
+			TotalWeight = totalWeight;
+		}
+	};
+
+	ref class IntegerGenerator sealed
+	{
+	public:
+		IntegerGenerator(ChaosEngine^ engine, int minValue, int maxValue) : _engine(engine), _minValue(minValue), _maxValue(maxValue) {}
+
+		int Next() { return _engine->NextInteger(_minValue, _maxValue); }
+
+	private:
+		ChaosEngine^ _engine;
+		int _minValue;
+		int _maxValue;
+	};
+
+	ref class ByteGenerator sealed
+	{
+	public:
+		ByteGenerator(ChaosEngine^ engine, unsigned char minValue, unsigned char maxValue) : _engine(engine), _minValue(minValue), _maxValue(maxValue) {}
+
+		unsigned char Next() { return _engine->NextByte(_minValue, _maxValue); }
+
+	private:
+		ChaosEngine^ _engine;
+		unsigned char _minValue;
+		unsigned char _maxValue;
+	};
+
+	ref class FloatGenerator sealed
+	{
+	public:
+		FloatGenerator(ChaosEngine^ engine, float minValue, float maxValue) : _engine(engine), _minValue(minValue), _maxValue(maxValue) {}
+
+		float Next() { return _engine->NextFloat(_minValue, _maxValue); }
+
+	private:
+		ChaosEngine^ _engine;
+		float _minValue;
+		float _maxValue;
+	};
+
+	ref class DoubleGenerator sealed
+	{
+	public:
+		DoubleGenerator(ChaosEngine^ engine, double minValue, double maxValue) : _engine(engine), _minValue(minValue), _maxValue(maxValue) {}
+
+		double Next() { return _engine->NextDouble(_minValue, _maxValue); }
+
+	private:
+		ChaosEngine^ _engine;
+		double _minValue;
+		double _maxValue;
+	};
+
+	ref class Int64Generator sealed
+	{
+	public:
+		Int64Generator(ChaosEngine^ engine, long long minValue, long long maxValue) : _engine(engine), _minValue(minValue), _maxValue(maxValue) {}
+
+		long long Next() { return _engine->NextInt64(_minValue, _maxValue); }
+
+	private:
+		ChaosEngine^ _engine;
+		long long _minValue;
+		long long _maxValue;
+	};
+
+	ref class GaussianGenerator sealed
+	{
+	public:
+		GaussianGenerator(ChaosEngine^ engine, float mean, float standardDeviation) : _engine(engine), _mean(mean), _standardDeviation(standardDeviation) {}
+
+		float Next() { return _engine->NextGaussian(_mean, _standardDeviation); }
+
+	private:
+		ChaosEngine^ _engine;
+		float _mean;
+		float _standardDeviation;
+	};
+
+	ref class ExponentialGenerator sealed
+	{
+	public:
+		ExponentialGenerator(ChaosEngine^ engine, float lambda) : _engine(engine), _lambda(lambda) {}
+
+		float Next() { return _engine->NextExponential(_lambda); }
+
+	private:
+		ChaosEngine^ _engine;
+		float _lambda;
+	};
+
+	ref class PoissonGenerator sealed
+	{
+	public:
+		PoissonGenerator(ChaosEngine^ engine, float mean) : _engine(engine), _mean(mean) {}
+
+		int Next() { return _engine->NextPoisson(_mean); }
+
+	private:
+		ChaosEngine^ _engine;
+		float _mean;
+	};
+
+	ref class ProbabilityGenerator sealed
+	{
+	public:
+		ProbabilityGenerator(ChaosEngine^ engine, float percent) : _engine(engine), _percent(percent) {}
+
+		bool Next() { return _engine->NextProbability(_percent); }
+
+	private:
+		ChaosEngine^ _engine;
+		float _percent;
+	};
+
+	ref class PercentGenerator sealed
+	{
+	public:
+		PercentGenerator(ChaosEngine^ engine, int percent) : _engine(engine), _percent(percent) {}
+
+		bool Next() { return _engine->NextProbability(_percent); }
+
+	private:
+		ChaosEngine^ _engine;
+		int _percent;
+	};
+
+	template <typename T, typename TConverter>
+	ref class ParallelFill sealed
+	{
+	public:
+		ParallelFill(T* buffer, int length, int seed, const TConverter* converter) : _buffer(buffer), _length(length), _seed(seed), _converter(converter) {}
+
+		void FillChunk(int chunk)
+		{
+			int offset = chunk * ParallelChunk;
+			ChaosCore core(ChaosEngine::DeriveSeed(_seed, chunk));
+			core.NextValues<T>(_buffer + offset, Math::Min(ParallelChunk, _length - offset), *_converter);
+		}
+
+	private:
+		T* _buffer;
+		int _length;
+		int _seed;
+		const TConverter* _converter;
+	};
+
+	ref class ParallelPreciseFill sealed
+	{
+	public:
+		ParallelPreciseFill(int* buffer, int length, int seed, int minValue, int maxValue) : _buffer(buffer), _length(length), _seed(seed), _minValue(minValue), _maxValue(maxValue) {}
+
+		void FillChunk(int chunk)
+		{
+			int offset = chunk * ParallelChunk;
+			ChaosCore core(ChaosEngine::DeriveSeed(_seed, chunk));
+			core.NextPreciseIntegers(_buffer + offset, Math::Min(ParallelChunk, _length - offset), _minValue, _maxValue);
+		}
+
+	private:
+		int* _buffer;
+		int _length;
+		int _seed;
+		int _minValue;
+		int _maxValue;
+	};
+
+	generic <typename T>
+	ref class ChoiceGenerator sealed
+	{
+	public:
+		ChoiceGenerator(ChaosEngine^ engine, IEnumerable<T>^ collection) : _engine(engine), _collection(collection) {}
+
+		T Next() { return _engine->Choose<T>(_collection); }
+
+	private:
+		ChaosEngine^ _engine;
+		IEnumerable<T>^ _collection;
+	};
+
+	generic <typename T>
+	ref class WeightedChoiceGenerator sealed
+	{
+	public:
+		WeightedChoiceGenerator(ChaosEngine^ engine, IEnumerable<IWeightedObject<T>^>^ collection) : _engine(engine), _collection(collection) {}
+
+		T Next() { return _engine->Choose<T>(_collection); }
+
+	private:
+		ChaosEngine^ _engine;
+		IEnumerable<IWeightedObject<T>^>^ _collection;
+	};
+
+	generic <typename T>
+	ref class SamplerChoiceGenerator sealed
+	{
+	public:
+		SamplerChoiceGenerator(ChaosEngine^ engine, WeightedSampler<T>^ sampler) : _engine(engine), _sampler(sampler) {}
+
+		T Next() { return _engine->Choose<T>(_sampler); }
+
+	private:
+		ChaosEngine^ _engine;
+		WeightedSampler<T>^ _sampler;
+	};
+
+	generic <typename T> where T : Enum
+	ref class EnumGenerator sealed
+	{
+	public:
+		EnumGenerator(ChaosEngine^ engine) : _engine(engine) {}
+
+		T Next() { return _engine->NextEnum<T>(); }
+
+	private:
+		ChaosEngine^ _engine;
+	};
+
 	String^ ChaosEngine::Seed::get()
 	{
 		return _seed;
@@ -62,6 +381,28 @@ namespace Aurora
 		s_Shared = engine;
 	}
 
+	ChaosEngine^ ChaosEngine::ThreadLocal::get()
+	{
+		if (s_ThreadLocal == nullptr)
+		{
+			ChaosEngine^ shared = Shared;
+			String^ stored;
+			int seed = DeriveSeed(ParseSeed(shared->Seed, stored), Thread::CurrentThread->ManagedThreadId);
+			s_ThreadLocal = gcnew ChaosEngine(seed, shared->Options | ChaosOptions::Unsynchronized);
+		}
+		return s_ThreadLocal;
+	}
+
+	ChaosOptions ChaosEngine::Options::get()
+	{
+		return _options;
+	}
+
+	bool ChaosEngine::IsSynchronized::get()
+	{
+		return !HasOption(ChaosOptions::Unsynchronized);
+	}
+
 	ChaosEngine::ChaosEngine()
 	{
 		Reseed(nullptr);
@@ -77,6 +418,77 @@ namespace Aurora
 		Reseed(seed);
 	}
 
+	ChaosEngine::ChaosEngine(ChaosOptions options)
+	{
+		_options = options;
+		Reseed(nullptr);
+	}
+
+	ChaosEngine::ChaosEngine(String^ seed, ChaosOptions options)
+	{
+		_options = options;
+		Reseed(seed);
+	}
+
+	ChaosEngine::ChaosEngine(int seed, ChaosOptions options)
+	{
+		_options = options;
+		Reseed(seed);
+	}
+
+	ChaosEngine::ChaosEngine(ChaosOptions options, int parentSeed, const int* samples, unsigned long long digest, int stream)
+	{
+		_options = options;
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext;
+		int iNextP;
+
+		ForkState(samples, digest, stream, seedArray, iNext, iNextP);
+		_seedValue = Native::DeriveSeed(parentSeed, seedArray[0]);
+		_seed = _seedValue.ToString();
+		_iNext = iNext;
+		_iNextP = iNextP;
+	}
+
+	ChaosEngine^ ChaosEngine::Fork()
+	{
+		int samples[StateLength];
+
+		LockState();
+
+		unsigned long long digest = ForkParent(samples);
+		int seed = _seedValue;
+
+		UnlockState();
+
+		return gcnew ChaosEngine(_options, seed, samples, digest, 1);
+	}
+
+	void ChaosEngine::Fork(array<ChaosEngine^>^% children)
+	{
+		if (children == nullptr || children->Length < 1)
+		{
+			ThrowBufferException("children");
+		}
+
+		Contract::EndContractBlock();
+
+		int samples[StateLength];
+
+		LockState();
+
+		unsigned long long digest = ForkParent(samples);
+		int seed = _seedValue;
+
+		UnlockState();
+
+		for (int i = 0; i < children->Length; i++)
+		{
+			children[i] = gcnew ChaosEngine(_options, seed, samples, digest, i + 1);
+		}
+	}
+
 	void ChaosEngine::Reset()
 	{
 		Reseed(_seed);
@@ -99,9 +511,124 @@ namespace Aurora
 		Reseed(seed, seed.ToString());
 	}
 
+	void ChaosEngine::Discard(long long count)
+	{
+		if (count < 0)
+		{
+			ThrowTooLowExceptionZero("count");
+		}
+
+		Contract::EndContractBlock();
+
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		DiscardSamples(seedArray, iNext, iNextP, static_cast<unsigned long long>(count));
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+	}
+
+	array<unsigned char>^ ChaosEngine::SaveState()
+	{
+		array<unsigned char>^ state = gcnew array<unsigned char>(StateSize);
+		SaveState(state);
+		return state;
+	}
+
+	void ChaosEngine::SaveState(array<unsigned char>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<unsigned char> pinned = &buffer[0];
+		SaveState(pinned, buffer->Length);
+	}
+
+	void ChaosEngine::SaveState(unsigned char* buffer, int length)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (length < StateSize)
+		{
+			ThrowTooLowException("length", Convert::ToString(StateSize));
+		}
+
+		Contract::EndContractBlock();
+
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		Native::SaveState(buffer, seedArray, _iNext, _seedValue, _parallelFills);
+
+		UnlockState();
+	}
+
+	void ChaosEngine::LoadState(array<unsigned char>^ state)
+	{
+		if (state == nullptr || state->Length < 1)
+		{
+			ThrowBufferException("state");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<unsigned char> pinned = &state[0];
+		LoadState(pinned, state->Length);
+	}
+
+	void ChaosEngine::LoadState(const unsigned char* state, int length)
+	{
+		if (state == nullptr || length < 1)
+		{
+			ThrowBufferException("state");
+		}
+
+		if (length < StateSize)
+		{
+			ThrowTooLowException("length", Convert::ToString(StateSize));
+		}
+
+		Contract::EndContractBlock();
+
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext;
+		int iNextP;
+		int seed;
+		unsigned int parallelFills;
+
+		if (!Native::LoadState(state, seedArray, iNext, iNextP, seed, parallelFills))
+		{
+			UnlockState();
+			ThrowInvalidStateException("state");
+		}
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+		_seedValue = seed;
+		_seed = seed.ToString();
+		_parallelFills = parallelFills;
+
+		UnlockState();
+	}
+
 	bool ChaosEngine::NextBoolean()
 	{
-		return NextInteger(0, 2) == 1;
+		return SampleToInteger(NextSample(), 0, 2) == 1;
 	}
 
 	void ChaosEngine::NextBooleans(array<bool>^% buffer)
@@ -113,10 +640,26 @@ namespace Aurora
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
+		pin_ptr<bool> values = &buffer[0];
+		NextBooleans(values, buffer->Length);
+	}
+
+	void ChaosEngine::NextBooleans(bool* buffer, int length)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::PackedBooleans))
 		{
-			buffer[i] = NextBoolean();
+			NextPackedValues<bool>(buffer, length, 1);
+			return;
 		}
+
+		NextValues<bool>(buffer, length, BooleanConverter());
 	}
 	//ThrowTooLowExceptionOne("count");
 
@@ -129,27 +672,1224 @@ namespace Aurora
 		
 		Contract::EndContractBlock();
 
-		List<bool>^ list = gcnew List<bool>();
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<bool>(gcnew Func<bool>(this, &ChaosEngine::NextBoolean), count);
+
+		array<bool>^ values = gcnew array<bool>(count);
+		NextBooleans(values);
+		return values;
+	}
 
-		for (int i = 0; i < count; i++)
+	Collections::BitArray^ ChaosEngine::NextBits(int count)
+	{
+		if (count < 1)
 		{
-			list->Add(NextBoolean());
+			ThrowTooLowExceptionOne("count");
 		}
 
-		return list;
+		Contract::EndContractBlock();
+
+		array<int>^ words = gcnew array<int>((count - 1) / 32 + 1);
+		pin_ptr<int> values = &words[0];
+		NextPackedValues<int>(values, words->Length, 32);
+
+		Collections::BitArray^ bits = gcnew Collections::BitArray(words);
+		bits->Length = count;
+		return bits;
 	}
 
-	bool ChaosEngine::NextProbability(float percent)
+	void ChaosEngine::NextBits(array<unsigned long long>^% buffer)
 	{
-		return percent >= 1 || (percent > 0 && NextFloat() < percent);
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<unsigned long long> values = &buffer[0];
+		NextBits(values, buffer->Length);
 	}
 
-	bool ChaosEngine::NextProbability(int percent)
+	void ChaosEngine::NextBits(unsigned long long* buffer, int length)
 	{
-		return percent >= 100 || (percent > 0 && NextInteger(100) < percent);
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		NextPackedValues<unsigned long long>(buffer, length, 64);
+	}
+
+	bool ChaosEngine::NextProbability(float percent)
+	{
+		return percent >= 1 || (percent > 0 && NextFloat() < percent);
+	}
+
+	bool ChaosEngine::NextProbability(double percent)
+	{
+		return percent >= 1 || (percent > 0 && NextDouble() < percent);
+	}
+
+	bool ChaosEngine::NextProbability(int percent)
+	{
+		return percent >= 100 || (percent > 0 && SampleToInteger(NextSample(), 0, 100) < percent);
+	}
+
+	void ChaosEngine::NextProbabilities(array<bool>^% buffer, float percent)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<bool> values = &buffer[0];
+		NextProbabilities(values, buffer->Length, percent);
+	}
+
+	void ChaosEngine::NextProbabilities(bool* buffer, int length, float percent)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		if (percent >= 1 || !(percent > 0))
+		{
+			FillValue<bool>(buffer, length, percent >= 1);
+			return;
+		}
+
+		if (HasOption(ChaosOptions::SparseProbabilities) && percent <= SparseProbabilityLimit)
+		{
+			NextSparseProbabilities(buffer, length, percent);
+			return;
+		}
+
+		ProbabilityConverter converter = { percent };
+		NextValues<bool>(buffer, length, converter);
+	}
+
+	void ChaosEngine::NextProbabilities(array<bool>^% buffer, int percent)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<bool> values = &buffer[0];
+		NextProbabilities(values, buffer->Length, percent);
+	}
+
+	void ChaosEngine::NextProbabilities(bool* buffer, int length, int percent)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		if (percent >= 100 || percent <= 0)
+		{
+			FillValue<bool>(buffer, length, percent >= 100);
+			return;
+		}
+
+		if (HasOption(ChaosOptions::SparseProbabilities) && percent <= SparseProbabilityLimit * 100)
+		{
+			NextSparseProbabilities(buffer, length, percent / 100.0);
+			return;
+		}
+
+		PercentConverter converter = { percent };
+		NextValues<bool>(buffer, length, converter);
+	}
+
+	IEnumerable<bool>^ ChaosEngine::NextProbabilities(int count, float percent)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<bool>(gcnew Func<bool>(gcnew ProbabilityGenerator(this, percent), &ProbabilityGenerator::Next), count);
+
+		array<bool>^ values = gcnew array<bool>(count);
+		NextProbabilities(values, percent);
+		return values;
+	}
+
+	IEnumerable<bool>^ ChaosEngine::NextProbabilities(int count, int percent)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<bool>(gcnew Func<bool>(gcnew PercentGenerator(this, percent), &PercentGenerator::Next), count);
+
+		array<bool>^ values = gcnew array<bool>(count);
+		NextProbabilities(values, percent);
+		return values;
+	}
+
+	array<int>^ ChaosEngine::NextProbabilityIndices(int length, float percent)
+	{
+		if (length < 1)
+		{
+			ThrowTooLowExceptionOne("length");
+		}
+
+		Contract::EndContractBlock();
+
+		if (!(percent > 0))
+			return gcnew array<int>(0);
+
+		if (percent >= 1)
+			return Enumerable::ToArray(Enumerable::Range(0, length));
+
+		List<int>^ indices = gcnew List<int>();
+		double logFailure = std::log1p(-static_cast<double>(percent));
+
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		for (int i = NextSparseIndex(seedArray, iNext, iNextP, 0, length, logFailure); i < length; i = NextSparseIndex(seedArray, iNext, iNextP, i + 1, length, logFailure))
+		{
+			indices->Add(i);
+		}
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+
+		return indices->ToArray();
+	}
+
+	bool ChaosEngine::NextOdds(int a, int b)
+	{
+		return NextOdds(static_cast<float>(a), static_cast<float>(b));
+	}
+
+	void ChaosEngine::NextOdds(array<bool>^% buffer, int a, int b)
+	{
+		NextOdds(buffer, static_cast<float>(a), static_cast<float>(b));
+	}
+
+	void ChaosEngine::NextOdds(bool* buffer, int length, int a, int b)
+	{
+		NextOdds(buffer, length, static_cast<float>(a), static_cast<float>(b));
+	}
+
+	IEnumerable<bool>^ ChaosEngine::NextOdds(int count, int a, int b)
+	{
+		return NextOdds(count, static_cast<float>(a), static_cast<float>(b));
+	}
+
+	bool ChaosEngine::NextOdds(float a, float b)
+	{
+		if (b == 0)
+		{
+			ThrowDivideByZeroException();
+		}
+
+		Contract::EndContractBlock();
+
+		return NextProbability(a / b);
+	}
+
+	void ChaosEngine::NextOdds(array<bool>^% buffer, float a, float b)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<bool> values = &buffer[0];
+		NextOdds(values, buffer->Length, a, b);
+	}
+
+	void ChaosEngine::NextOdds(bool* buffer, int length, float a, float b)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (b == 0)
+		{
+			ThrowDivideByZeroException();
+		}
+
+		Contract::EndContractBlock();
+
+		NextProbabilities(buffer, length, a / b);
+	}
+
+	IEnumerable<bool>^ ChaosEngine::NextOdds(int count, float a, float b)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		if (b == 0)
+		{
+			ThrowDivideByZeroException();
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<bool>(gcnew Func<bool>(gcnew ProbabilityGenerator(this, a / b), &ProbabilityGenerator::Next), count);
+
+		array<bool>^ values = gcnew array<bool>(count);
+		NextOdds(values, a, b);
+		return values;
+	}
+
+	int ChaosEngine::NextBinomial(int trials, float percent)
+	{
+		if (trials < 0)
+		{
+			ThrowTooLowExceptionZero("trials");
+		}
+
+		Contract::EndContractBlock();
+
+		if (trials == 0 || percent >= 1 || !(percent > 0))
+			return percent >= 1 ? trials : 0;
+
+		int retVal;
+		NextDistributionValues<int>(&retVal, 1, BinomialDistribution(trials, percent));
+		return retVal;
+	}
+
+	int ChaosEngine::NextBinomial(int trials, int percent)
+	{
+		if (trials < 0)
+		{
+			ThrowTooLowExceptionZero("trials");
+		}
+
+		Contract::EndContractBlock();
+
+		if (trials == 0 || percent >= 100 || percent <= 0)
+			return percent >= 100 ? trials : 0;
+
+		int retVal;
+		NextDistributionValues<int>(&retVal, 1, BinomialDistribution(trials, percent / 100.0));
+		return retVal;
+	}
+
+	int ChaosEngine::NextBinomial(int trials, int a, int b)
+	{
+		return NextBinomial(trials, static_cast<float>(a), static_cast<float>(b));
+	}
+
+	int ChaosEngine::NextBinomial(int trials, float a, float b)
+	{
+		if (b == 0)
+		{
+			ThrowDivideByZeroException();
+		}
+
+		Contract::EndContractBlock();
+
+		return NextBinomial(trials, a / b);
+	}
+
+	array<int>^ ChaosEngine::NextMultinomial(int trials, array<double>^ weights)
+	{
+		if (trials < 0)
+		{
+			ThrowTooLowExceptionZero("trials");
+		}
+
+		if (weights == nullptr || weights->Length < 1)
+		{
+			ThrowBufferException("weights");
+		}
+
+		Contract::EndContractBlock();
+
+		double totalWeight = 0;
+
+		for (int i = 0; i < weights->Length; i++)
+		{
+			if (weights[i] > 0)
+				totalWeight += weights[i];
+		}
+
+		if (!(totalWeight > 0) || Double::IsInfinity(totalWeight))
+		{
+			ThrowWeightException("weights");
+		}
+
+		array<int>^ counts = gcnew array<int>(weights->Length);
+		pin_ptr<double> pinnedWeights = &weights[0];
+		pin_ptr<int> pinnedCounts = &counts[0];
+
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		GenerateMultinomial(seedArray, iNext, iNextP, trials, pinnedWeights, weights->Length, totalWeight, pinnedCounts);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+
+		return counts;
+	}
+
+	unsigned char ChaosEngine::NextByte()
+	{
+		return static_cast<unsigned char>(NextInteger(0, 256));
+	}
+
+	unsigned char ChaosEngine::NextByte(unsigned char minValue, unsigned char maxValue)
+	{
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue)
+			return minValue;
+
+		return static_cast<unsigned char>(NextInteger(static_cast<int>(minValue), static_cast<int>(maxValue) + 1));
+	}
+
+	unsigned char ChaosEngine::NextByte(unsigned char maxValue)
+	{
+		return NextByte(0, maxValue);
+	}
+
+	void ChaosEngine::NextBytes(array<unsigned char>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<unsigned char> values = &buffer[0];
+		NextBytes(values, buffer->Length);
+	}
+
+	void ChaosEngine::NextBytes(unsigned char* buffer, int length)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::PackedBytes))
+		{
+			NextPackedValues<unsigned char>(buffer, length, 8);
+			return;
+		}
+
+		if (HasOption(ChaosOptions::PreciseIntegers))
+		{
+			NextPreciseValues<unsigned char>(buffer, length, 0, 256);
+			return;
+		}
+
+		ByteConverter converter = { 0, 256 };
+		NextValues<unsigned char>(buffer, length, converter);
+	}
+
+	void ChaosEngine::NextBytes(array<unsigned char>^% buffer, unsigned char minValue, unsigned char maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<unsigned char> values = &buffer[0];
+		NextBytes(values, buffer->Length, minValue, maxValue);
+	}
+
+	void ChaosEngine::NextBytes(unsigned char* buffer, int length, unsigned char minValue, unsigned char maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue)
+		{
+			FillValue<unsigned char>(buffer, length, minValue);
+			return;
+		}
+
+		if (HasOption(ChaosOptions::PreciseIntegers))
+		{
+			NextPreciseValues<unsigned char>(buffer, length, minValue, maxValue + 1);
+			return;
+		}
+
+		ByteConverter converter = { static_cast<int>(minValue), static_cast<int>(maxValue) + 1 };
+		NextValues<unsigned char>(buffer, length, converter);
+	}
+
+	void ChaosEngine::NextBytes(array<unsigned char>^% buffer, unsigned char maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<unsigned char> values = &buffer[0];
+		NextBytes(values, buffer->Length, maxValue);
+	}
+
+	void ChaosEngine::NextBytes(unsigned char* buffer, int length, unsigned char maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		NextBytes(buffer, length, 0, maxValue);
+	}
+
+	IEnumerable<unsigned char>^ ChaosEngine::NextBytes(int count)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<unsigned char>(gcnew Func<unsigned char>(gcnew ByteGenerator(this, 0, 255), &ByteGenerator::Next), count);
+
+		array<unsigned char>^ values = gcnew array<unsigned char>(count);
+		NextBytes(values);
+		return values;
+	}
+
+	IEnumerable<unsigned char>^ ChaosEngine::NextBytes(int count, unsigned char minValue, unsigned char maxValue)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<unsigned char>(gcnew Func<unsigned char>(gcnew ByteGenerator(this, minValue, maxValue), &ByteGenerator::Next), count);
+
+		array<unsigned char>^ values = gcnew array<unsigned char>(count);
+		NextBytes(values, minValue, maxValue);
+		return values;
+	}
+
+	IEnumerable<unsigned char>^ ChaosEngine::NextBytes(int count, unsigned char maxValue)
+	{
+		return NextBytes(count, 0, maxValue);
+	}
+
+	int ChaosEngine::NextInteger()
+	{
+		return NextSample();
+	}
+
+	int ChaosEngine::NextInteger(int minValue, int maxValue)
+	{
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue - 1)
+			return minValue;
+
+		if (HasOption(ChaosOptions::PreciseIntegers))
+			return NextPreciseInteger(minValue, maxValue);
+
+		return SampleToInteger(NextSample(), minValue, maxValue);
+	}
+
+	int ChaosEngine::NextInteger(int maxValue)
+	{
+		return NextInteger(0, maxValue);
+	}
+
+	void ChaosEngine::NextIntegers(array<int>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> values = &buffer[0];
+		NextIntegers(values, buffer->Length);
+	}
+
+	void ChaosEngine::NextIntegers(int* buffer, int length)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		LockState();
+		NextSamples(buffer, length);
+		UnlockState();
+	}
+
+	void ChaosEngine::NextIntegers(array<int>^% buffer, int minValue, int maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> values = &buffer[0];
+		NextIntegers(values, buffer->Length, minValue, maxValue);
+	}
+
+	void ChaosEngine::NextIntegers(int* buffer, int length, int minValue, int maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue - 1)
+		{
+			FillValue<int>(buffer, length, minValue);
+			return;
+		}
+
+		if (HasOption(ChaosOptions::PreciseIntegers))
+		{
+			NextPreciseValues<int>(buffer, length, minValue, maxValue);
+			return;
+		}
+
+		IntegerConverter converter = { minValue, maxValue };
+		NextValues<int>(buffer, length, converter);
+	}
+
+	void ChaosEngine::NextIntegers(array<int>^% buffer, int maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> values = &buffer[0];
+		NextIntegers(values, buffer->Length, maxValue);
+	}
+
+	void ChaosEngine::NextIntegers(int* buffer, int length, int maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		NextIntegers(buffer, length, 0, maxValue);
+	}
+
+	IEnumerable<int>^ ChaosEngine::NextIntegers(int count)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<int>(gcnew Func<int>(this, &ChaosEngine::NextInteger), count);
+
+		array<int>^ values = gcnew array<int>(count);
+		NextIntegers(values);
+		return values;
+	}
+
+	IEnumerable<int>^ ChaosEngine::NextIntegers(int count, int minValue, int maxValue)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<int>(gcnew Func<int>(gcnew IntegerGenerator(this, minValue, maxValue), &IntegerGenerator::Next), count);
+
+		array<int>^ values = gcnew array<int>(count);
+		NextIntegers(values, minValue, maxValue);
+		return values;
+	}
+
+	IEnumerable<int>^ ChaosEngine::NextIntegers(int count, int maxValue)
+	{
+		return NextIntegers(count, 0, maxValue);
+	}
+
+	void ChaosEngine::NextIntegersParallel(array<int>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> pinned = &buffer[0];
+		NextIntegersParallel(pinned, buffer->Length);
+	}
+
+	void ChaosEngine::NextIntegersParallel(int* buffer, int length)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		NextValuesParallel<int>(buffer, length, SampleConverter());
+	}
+
+	void ChaosEngine::NextIntegersParallel(array<int>^% buffer, int minValue, int maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> pinned = &buffer[0];
+		NextIntegersParallel(pinned, buffer->Length, minValue, maxValue);
+	}
+
+	void ChaosEngine::NextIntegersParallel(int* buffer, int length, int minValue, int maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue - 1)
+		{
+			FillValue<int>(buffer, length, minValue);
+			return;
+		}
+
+		if (HasOption(ChaosOptions::PreciseIntegers))
+		{
+			int seed = NextParallelSeed();
+			int chunks = (length - 1) / ParallelChunk + 1;
+
+			ParallelPreciseFill^ fill = gcnew ParallelPreciseFill(buffer, length, seed, minValue, maxValue);
+			Parallel::For(0, chunks, gcnew Action<int>(fill, &ParallelPreciseFill::FillChunk));
+			return;
+		}
+
+		IntegerConverter converter = { minValue, maxValue };
+		NextValuesParallel<int>(buffer, length, converter);
+	}
+
+	float ChaosEngine::NextFloat()
+	{
+		return NextRange(true);
+	}
+
+	float ChaosEngine::NextFloat(float minValue, float maxValue)
+	{
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue)
+			return minValue;
+
+		double range = maxValue - minValue;
+		return SampleToFloat(NextSample(), minValue, range);
+	}
+
+	float ChaosEngine::NextFloat(float maxValue)
+	{
+		return NextFloat(0, maxValue);
+	}
+
+	void ChaosEngine::NextFloats(array<float>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<float> values = &buffer[0];
+		NextFloats(values, buffer->Length);
+	}
+
+	void ChaosEngine::NextFloats(float* buffer, int length)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		NextValues<float>(buffer, length, UnitFloatConverter());
+	}
+
+	void ChaosEngine::NextFloats(array<float>^% buffer, float minValue, float maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<float> values = &buffer[0];
+		NextFloats(values, buffer->Length, minValue, maxValue);
+	}
+
+	void ChaosEngine::NextFloats(float* buffer, int length, float minValue, float maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue)
+		{
+			FillValue<float>(buffer, length, minValue);
+			return;
+		}
+
+		FloatConverter converter = { minValue, maxValue - minValue };
+		NextValues<float>(buffer, length, converter);
+	}
+
+	void ChaosEngine::NextFloats(array<float>^% buffer, float maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<float> values = &buffer[0];
+		NextFloats(values, buffer->Length, maxValue);
+	}
+
+	void ChaosEngine::NextFloats(float* buffer, int length, float maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		NextFloats(buffer, length, 0, maxValue);
+	}
+
+	IEnumerable<float>^ ChaosEngine::NextFloats(int count)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<float>(gcnew Func<float>(this, &ChaosEngine::NextFloat), count);
+
+		array<float>^ values = gcnew array<float>(count);
+		NextFloats(values);
+		return values;
+	}
+
+	IEnumerable<float>^ ChaosEngine::NextFloats(int count, float minValue, float maxValue)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<float>(gcnew Func<float>(gcnew FloatGenerator(this, minValue, maxValue), &FloatGenerator::Next), count);
+
+		array<float>^ values = gcnew array<float>(count);
+		NextFloats(values, minValue, maxValue);
+		return values;
+	}
+
+	IEnumerable<float>^ ChaosEngine::NextFloats(int count, float maxValue)
+	{
+		return NextFloats(count, 0, maxValue);
+	}
+
+	double ChaosEngine::NextDouble()
+	{
+		LockState();
+
+		int high = NextSample();
+		double retVal = SamplesToDouble(high, NextSample());
+
+		UnlockState();
+
+		return retVal;
+	}
+
+	double ChaosEngine::NextDouble(double minValue, double maxValue)
+	{
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue)
+			return minValue;
+
+		return minValue + NextDouble() * (maxValue - minValue);
+	}
+
+	double ChaosEngine::NextDouble(double maxValue)
+	{
+		return NextDouble(0, maxValue);
+	}
+
+	void ChaosEngine::NextDoubles(array<double>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<double> values = &buffer[0];
+		NextDoubles(values, buffer->Length);
+	}
+
+	void ChaosEngine::NextDoubles(double* buffer, int length)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		NextPairedValues<double>(buffer, length, UnitDoubleConverter());
+	}
+
+	void ChaosEngine::NextDoubles(array<double>^% buffer, double minValue, double maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<double> values = &buffer[0];
+		NextDoubles(values, buffer->Length, minValue, maxValue);
+	}
+
+	void ChaosEngine::NextDoubles(double* buffer, int length, double minValue, double maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue)
+		{
+			FillValue<double>(buffer, length, minValue);
+			return;
+		}
+
+		DoubleConverter converter = { minValue, maxValue - minValue };
+		NextPairedValues<double>(buffer, length, converter);
+	}
+
+	void ChaosEngine::NextDoubles(array<double>^% buffer, double maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<double> values = &buffer[0];
+		NextDoubles(values, buffer->Length, maxValue);
+	}
+
+	void ChaosEngine::NextDoubles(double* buffer, int length, double maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		NextDoubles(buffer, length, 0, maxValue);
+	}
+
+	IEnumerable<double>^ ChaosEngine::NextDoubles(int count)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<double>(gcnew Func<double>(this, &ChaosEngine::NextDouble), count);
+
+		array<double>^ values = gcnew array<double>(count);
+		NextDoubles(values);
+		return values;
+	}
+
+	IEnumerable<double>^ ChaosEngine::NextDoubles(int count, double minValue, double maxValue)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<double>(gcnew Func<double>(gcnew DoubleGenerator(this, minValue, maxValue), &DoubleGenerator::Next), count);
+
+		array<double>^ values = gcnew array<double>(count);
+		NextDoubles(values, minValue, maxValue);
+		return values;
+	}
+
+	IEnumerable<double>^ ChaosEngine::NextDoubles(int count, double maxValue)
+	{
+		return NextDoubles(count, 0, maxValue);
+	}
+
+	long long ChaosEngine::NextInt64()
+	{
+		return static_cast<long long>(NextWideInteger(1ULL << 63));
+	}
+
+	long long ChaosEngine::NextInt64(long long minValue, long long maxValue)
+	{
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue - 1)
+			return minValue;
+
+		unsigned long long range = static_cast<unsigned long long>(maxValue) - static_cast<unsigned long long>(minValue);
+		return static_cast<long long>(static_cast<unsigned long long>(minValue) + NextWideInteger(range));
+	}
+
+	long long ChaosEngine::NextInt64(long long maxValue)
+	{
+		return NextInt64(0, maxValue);
+	}
+
+	void ChaosEngine::NextInt64s(array<long long>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<long long> values = &buffer[0];
+		NextInt64s(values, buffer->Length);
+	}
+
+	void ChaosEngine::NextInt64s(long long* buffer, int length)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		NextWideValues<long long>(buffer, length, 0, 1ULL << 63);
+	}
+
+	void ChaosEngine::NextInt64s(array<long long>^% buffer, long long minValue, long long maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<long long> values = &buffer[0];
+		NextInt64s(values, buffer->Length, minValue, maxValue);
+	}
+
+	void ChaosEngine::NextInt64s(long long* buffer, int length, long long minValue, long long maxValue)
+	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue - 1)
+		{
+			FillValue<long long>(buffer, length, minValue);
+			return;
+		}
+
+		unsigned long long range = static_cast<unsigned long long>(maxValue) - static_cast<unsigned long long>(minValue);
+		NextWideValues<long long>(buffer, length, static_cast<unsigned long long>(minValue), range);
 	}
 
-	void ChaosEngine::NextProbabilities(array<bool>^% buffer, float percent)
+	void ChaosEngine::NextInt64s(array<long long>^% buffer, long long maxValue)
 	{
 		if (buffer == nullptr || buffer->Length < 1)
 		{
@@ -158,28 +1898,23 @@ namespace Aurora
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
-		{
-			buffer[i] = NextProbability(percent);
-		}
+		pin_ptr<long long> values = &buffer[0];
+		NextInt64s(values, buffer->Length, maxValue);
 	}
 
-	void ChaosEngine::NextProbabilities(array<bool>^% buffer, int percent)
+	void ChaosEngine::NextInt64s(long long* buffer, int length, long long maxValue)
 	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (buffer == nullptr || length < 1)
 		{
 			ThrowBufferException("buffer");
 		}
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
-		{
-			buffer[i] = NextProbability(percent);
-		}
+		NextInt64s(buffer, length, 0, maxValue);
 	}
 
-	IEnumerable<bool>^ ChaosEngine::NextProbabilities(int count, float percent)
+	IEnumerable<long long>^ ChaosEngine::NextInt64s(int count)
 	{
 		if (count < 1)
 		{
@@ -188,78 +1923,72 @@ namespace Aurora
 
 		Contract::EndContractBlock();
 
-		List<bool>^ list = gcnew List<bool>();
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<long long>(gcnew Func<long long>(this, &ChaosEngine::NextInt64), count);
 
-		for (int i = 0; i < count; i++)
-		{
-			list->Add(NextProbability(percent));
-		}
-
-		return list;
+		array<long long>^ values = gcnew array<long long>(count);
+		NextInt64s(values);
+		return values;
 	}
 
-	IEnumerable<bool>^ ChaosEngine::NextProbabilities(int count, int percent)
+	IEnumerable<long long>^ ChaosEngine::NextInt64s(int count, long long minValue, long long maxValue)
 	{
 		if (count < 1)
 		{
 			ThrowTooLowExceptionOne("count");
 		}
 
-		Contract::EndContractBlock();
-
-		List<bool>^ list = gcnew List<bool>();
-
-		for (int i = 0; i < count; i++)
+		if (minValue >= maxValue)
 		{
-			list->Add(NextProbability(percent));
+			ThrowMinMaxException("minValue", "maxValue", false);
 		}
 
-		return list;
-	}
+		Contract::EndContractBlock();
 
-	bool ChaosEngine::NextOdds(int a, int b)
-	{
-		return NextOdds(static_cast<float>(a), static_cast<float>(b));
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<long long>(gcnew Func<long long>(gcnew Int64Generator(this, minValue, maxValue), &Int64Generator::Next), count);
+
+		array<long long>^ values = gcnew array<long long>(count);
+		NextInt64s(values, minValue, maxValue);
+		return values;
 	}
 
-	void ChaosEngine::NextOdds(array<bool>^% buffer, int a, int b)
+	IEnumerable<long long>^ ChaosEngine::NextInt64s(int count, long long maxValue)
 	{
-		NextOdds(buffer, static_cast<float>(a), static_cast<float>(b));
+		return NextInt64s(count, 0, maxValue);
 	}
 
-	IEnumerable<bool>^ ChaosEngine::NextOdds(int count, int a, int b)
+	unsigned long long ChaosEngine::NextUInt64()
 	{
-		return NextOdds(count, static_cast<float>(a), static_cast<float>(b));
+		return NextWideInteger(0);
 	}
 
-	bool ChaosEngine::NextOdds(float a, float b)
+	void ChaosEngine::NextUInt64s(array<unsigned long long>^% buffer)
 	{
-		if (b == 0)
+		if (buffer == nullptr || buffer->Length < 1)
 		{
-			ThrowDivideByZeroException();
+			ThrowBufferException("buffer");
 		}
 
 		Contract::EndContractBlock();
 
-		return NextProbability(a / b);
+		pin_ptr<unsigned long long> values = &buffer[0];
+		NextUInt64s(values, buffer->Length);
 	}
 
-	void ChaosEngine::NextOdds(array<bool>^% buffer, float a, float b)
+	void ChaosEngine::NextUInt64s(unsigned long long* buffer, int length)
 	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (buffer == nullptr || length < 1)
 		{
 			ThrowBufferException("buffer");
 		}
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
-		{
-			buffer[i] = NextOdds(a, b);
-		}
+		NextWideValues<unsigned long long>(buffer, length, 0, 0);
 	}
 
-	IEnumerable<bool>^ ChaosEngine::NextOdds(int count, float a, float b)
+	IEnumerable<unsigned long long>^ ChaosEngine::NextUInt64s(int count)
 	{
 		if (count < 1)
 		{
@@ -268,42 +1997,34 @@ namespace Aurora
 
 		Contract::EndContractBlock();
 
-		List<bool>^ list = gcnew List<bool>();
-
-		for (int i = 0; i < count; i++)
-		{
-			list->Add(NextOdds(a, b));
-		}
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<unsigned long long>(gcnew Func<unsigned long long>(this, &ChaosEngine::NextUInt64), count);
 
-		return list;
+		array<unsigned long long>^ values = gcnew array<unsigned long long>(count);
+		NextUInt64s(values);
+		return values;
 	}
 
-	unsigned char ChaosEngine::NextByte()
+	float ChaosEngine::NextGaussian()
 	{
-		return static_cast<unsigned char>(NextInteger(0, 256));
+		return NextGaussian(0, 1);
 	}
 
-	unsigned char ChaosEngine::NextByte(unsigned char minValue, unsigned char maxValue)
+	float ChaosEngine::NextGaussian(float mean, float standardDeviation)
 	{
-		if (minValue > maxValue)
+		if (!(standardDeviation >= 0))
 		{
-			ThrowMinMaxException("minValue", "maxValue", true);
+			ThrowTooLowExceptionZero("standardDeviation");
 		}
 
 		Contract::EndContractBlock();
 
-		if (minValue == maxValue)
-			return minValue;
-
-		return static_cast<unsigned char>(NextInteger(static_cast<int>(minValue), static_cast<int>(maxValue) + 1));
-	}
-
-	unsigned char ChaosEngine::NextByte(unsigned char maxValue)
-	{
-		return NextByte(0, maxValue);
+		float retVal;
+		NextDistributionValues<float>(&retVal, 1, NormalDistribution{ mean, standardDeviation });
+		return retVal;
 	}
 
-	void ChaosEngine::NextBytes(array<unsigned char>^% buffer)
+	void ChaosEngine::NextGaussians(array<float>^% buffer, float mean, float standardDeviation)
 	{
 		if (buffer == nullptr || buffer->Length < 1)
 		{
@@ -312,141 +2033,135 @@ namespace Aurora
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
-		{
-			buffer[i] = NextByte();
-		}
+		pin_ptr<float> values = &buffer[0];
+		NextGaussians(values, buffer->Length, mean, standardDeviation);
 	}
 
-	void ChaosEngine::NextBytes(array<unsigned char>^% buffer, unsigned char minValue, unsigned char maxValue)
+	void ChaosEngine::NextGaussians(float* buffer, int length, float mean, float standardDeviation)
 	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (buffer == nullptr || length < 1)
 		{
 			ThrowBufferException("buffer");
 		}
 
-		Contract::EndContractBlock();
-
-		for (int i = 0; i < buffer->Length; i++)
-		{
-			buffer[i] = NextByte(minValue, maxValue);
-		}
-	}
-
-	void ChaosEngine::NextBytes(array<unsigned char>^% buffer, unsigned char maxValue)
-	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (!(standardDeviation >= 0))
 		{
-			ThrowBufferException("buffer");
+			ThrowTooLowExceptionZero("standardDeviation");
 		}
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
-		{
-			buffer[i] = NextByte(maxValue);
-		}
+		NextDistributionValues<float>(buffer, length, NormalDistribution{ mean, standardDeviation });
 	}
 
-	IEnumerable<unsigned char>^ ChaosEngine::NextBytes(int count)
+	IEnumerable<float>^ ChaosEngine::NextGaussians(int count, float mean, float standardDeviation)
 	{
 		if (count < 1)
 		{
 			ThrowTooLowExceptionOne("count");
 		}
 
-		Contract::EndContractBlock();
-
-		List<unsigned char>^ list = gcnew List<unsigned char>();
-
-		for (int i = 0; i < count; i++)
+		if (!(standardDeviation >= 0))
 		{
-			list->Add(NextByte());
+			ThrowTooLowExceptionZero("standardDeviation");
 		}
 
-		return list;
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<float>(gcnew Func<float>(gcnew GaussianGenerator(this, mean, standardDeviation), &GaussianGenerator::Next), count);
+
+		array<float>^ values = gcnew array<float>(count);
+		NextGaussians(values, mean, standardDeviation);
+		return values;
 	}
 
-	IEnumerable<unsigned char>^ ChaosEngine::NextBytes(int count, unsigned char minValue, unsigned char maxValue)
+	float ChaosEngine::NextExponential(float lambda)
 	{
-		if (count < 1)
+		if (!(lambda > 0))
 		{
-			ThrowTooLowExceptionOne("count");
+			ThrowTooLowException("lambda", "or equal to zero");
 		}
 
 		Contract::EndContractBlock();
 
-		List<unsigned char>^ list = gcnew List<unsigned char>();
+		float retVal;
+		NextDistributionValues<float>(&retVal, 1, ExponentialDistribution{ lambda });
+		return retVal;
+	}
 
-		for (int i = 0; i < count; i++)
+	void ChaosEngine::NextExponentials(array<float>^% buffer, float lambda)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
 		{
-			list->Add(NextByte(minValue, maxValue));
+			ThrowBufferException("buffer");
 		}
 
-		return list;
+		Contract::EndContractBlock();
+
+		pin_ptr<float> values = &buffer[0];
+		NextExponentials(values, buffer->Length, lambda);
 	}
 
-	IEnumerable<unsigned char>^ ChaosEngine::NextBytes(int count, unsigned char maxValue)
+	void ChaosEngine::NextExponentials(float* buffer, int length, float lambda)
 	{
-		if (count < 1)
+		if (buffer == nullptr || length < 1)
 		{
-			ThrowTooLowExceptionOne("count");
+			ThrowBufferException("buffer");
 		}
 
-		Contract::EndContractBlock();
-
-		List<unsigned char>^ list = gcnew List<unsigned char>();
-
-		for (int i = 0; i < count; i++)
+		if (!(lambda > 0))
 		{
-			list->Add(NextByte(maxValue));
+			ThrowTooLowException("lambda", "or equal to zero");
 		}
 
-		return list;
-	}
+		Contract::EndContractBlock();
 
-	int ChaosEngine::NextInteger()
-	{
-		return NextSample();
+		NextDistributionValues<float>(buffer, length, ExponentialDistribution{ lambda });
 	}
 
-	int ChaosEngine::NextInteger(int minValue, int maxValue)
+	IEnumerable<float>^ ChaosEngine::NextExponentials(int count, float lambda)
 	{
-		if (minValue >= maxValue)
+		if (count < 1)
 		{
-			ThrowMinMaxException("minValue", "maxValue", false);
+			ThrowTooLowExceptionOne("count");
+		}
+
+		if (!(lambda > 0))
+		{
+			ThrowTooLowException("lambda", "or equal to zero");
 		}
 
 		Contract::EndContractBlock();
 
-		if (minValue == maxValue - 1)
-			return minValue;
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<float>(gcnew Func<float>(gcnew ExponentialGenerator(this, lambda), &ExponentialGenerator::Next), count);
 
-		long range = maxValue - minValue;
-		return static_cast<int>(NextRange(false) * range) + minValue;
+		array<float>^ values = gcnew array<float>(count);
+		NextExponentials(values, lambda);
+		return values;
 	}
 
-	int ChaosEngine::NextInteger(int maxValue)
+	int ChaosEngine::NextPoisson(float mean)
 	{
-		return NextInteger(0, maxValue);
-	}
+		if (!(mean >= 0))
+		{
+			ThrowTooLowExceptionZero("mean");
+		}
 
-	void ChaosEngine::NextIntegers(array<int>^% buffer)
-	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (mean > MaxPoissonMean)
 		{
-			ThrowBufferException("buffer");
+			ThrowTooHighException("mean", "one billion");
 		}
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
-		{
-			buffer[i] = NextInteger();
-		}
+		int retVal;
+		NextDistributionValues<int>(&retVal, 1, PoissonDistribution(mean));
+		return retVal;
 	}
 
-	void ChaosEngine::NextIntegers(array<int>^% buffer, int minValue, int maxValue)
+	void ChaosEngine::NextPoissons(array<int>^% buffer, float mean)
 	{
 		if (buffer == nullptr || buffer->Length < 1)
 		{
@@ -455,91 +2170,104 @@ namespace Aurora
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
-		{
-			buffer[i] = NextInteger(minValue, maxValue);
-		}
+		pin_ptr<int> values = &buffer[0];
+		NextPoissons(values, buffer->Length, mean);
 	}
 
-	void ChaosEngine::NextIntegers(array<int>^% buffer, int maxValue)
+	void ChaosEngine::NextPoissons(int* buffer, int length, float mean)
 	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (buffer == nullptr || length < 1)
 		{
 			ThrowBufferException("buffer");
 		}
 
-		Contract::EndContractBlock();
+		if (!(mean >= 0))
+		{
+			ThrowTooLowExceptionZero("mean");
+		}
 
-		for (int i = 0; i < buffer->Length; i++)
+		if (mean > MaxPoissonMean)
 		{
-			buffer[i] = NextInteger(maxValue);
+			ThrowTooHighException("mean", "one billion");
 		}
+
+		Contract::EndContractBlock();
+
+		NextDistributionValues<int>(buffer, length, PoissonDistribution(mean));
 	}
 
-	IEnumerable<int>^ ChaosEngine::NextIntegers(int count)
+	IEnumerable<int>^ ChaosEngine::NextPoissons(int count, float mean)
 	{
 		if (count < 1)
 		{
 			ThrowTooLowExceptionOne("count");
 		}
 
-		Contract::EndContractBlock();
-
-		List<int>^ list = gcnew List<int>();
-
-		for (int i = 0; i < count; i++)
+		if (!(mean >= 0))
 		{
-			list->Add(NextInteger());
+			ThrowTooLowExceptionZero("mean");
 		}
 
-		return list;
-	}
-
-	IEnumerable<int>^ ChaosEngine::NextIntegers(int count, int minValue, int maxValue)
-	{
-		if (count < 1)
+		if (mean > MaxPoissonMean)
 		{
-			ThrowTooLowExceptionOne("count");
+			ThrowTooHighException("mean", "one billion");
 		}
 
 		Contract::EndContractBlock();
 
-		List<int>^ list = gcnew List<int>();
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<int>(gcnew Func<int>(gcnew PoissonGenerator(this, mean), &PoissonGenerator::Next), count);
+
+		array<int>^ values = gcnew array<int>(count);
+		NextPoissons(values, mean);
+		return values;
+	}
 
-		for (int i = 0; i < count; i++)
+	void ChaosEngine::NextFloatsParallel(array<float>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
 		{
-			list->Add(NextInteger(minValue, maxValue));
+			ThrowBufferException("buffer");
 		}
 
-		return list;
+		Contract::EndContractBlock();
+
+		pin_ptr<float> pinned = &buffer[0];
+		NextFloatsParallel(pinned, buffer->Length);
 	}
 
-	IEnumerable<int>^ ChaosEngine::NextIntegers(int count, int maxValue)
+	void ChaosEngine::NextFloatsParallel(float* buffer, int length)
 	{
-		if (count < 1)
+		if (buffer == nullptr || length < 1)
 		{
-			ThrowTooLowExceptionOne("count");
+			ThrowBufferException("buffer");
 		}
 
 		Contract::EndContractBlock();
 
-		List<int>^ list = gcnew List<int>();
+		NextValuesParallel<float>(buffer, length, UnitFloatConverter());
+	}
 
-		for (int i = 0; i < count; i++)
+	void ChaosEngine::NextFloatsParallel(array<float>^% buffer, float minValue, float maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
 		{
-			list->Add(NextInteger(maxValue));
+			ThrowBufferException("buffer");
 		}
 
-		return list;
-	}
+		Contract::EndContractBlock();
 
-	float ChaosEngine::NextFloat()
-	{
-		return NextRange(true);
+		pin_ptr<float> pinned = &buffer[0];
+		NextFloatsParallel(pinned, buffer->Length, minValue, maxValue);
 	}
 
-	float ChaosEngine::NextFloat(float minValue, float maxValue)
+	void ChaosEngine::NextFloatsParallel(float* buffer, int length, float minValue, float maxValue)
 	{
+		if (buffer == nullptr || length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
 		if (minValue > maxValue)
 		{
 			ThrowMinMaxException("minValue", "maxValue", true);
@@ -548,297 +2276,439 @@ namespace Aurora
 		Contract::EndContractBlock();
 
 		if (minValue == maxValue)
-			return minValue;
-
-		double range = maxValue - minValue;
-		return static_cast<float>(static_cast<double>(NextFloat() * range)) + minValue;
-	}
+		{
+			FillValue<float>(buffer, length, minValue);
+			return;
+		}
 
-	float ChaosEngine::NextFloat(float maxValue)
-	{
-		return NextFloat(0, maxValue);
+		FloatConverter converter = { minValue, maxValue - minValue };
+		NextValuesParallel<float>(buffer, length, converter);
 	}
 
-	void ChaosEngine::NextFloats(array<float>^% buffer)
+	generic <typename T>
+	void ChaosEngine::Shuffle(IList<T>^% list)
 	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (list == nullptr || list->Count < 1)
 		{
-			ThrowBufferException("buffer");
+			ThrowBufferException("list");
 		}
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
+		int n = list->Count;
+
+		while (n > 1)
 		{
-			buffer[i] = NextFloat();
+			n--;
+			int k = NextInteger(n + 1);
+
+			T temp = list[n];
+			list[n] = list[k];
+			list[k] = temp;
 		}
 	}
 
-	void ChaosEngine::NextFloats(array<float>^% buffer, float minValue, float maxValue)
+	generic <typename T>
+	void ChaosEngine::Shuffle(array<T>^% array)
 	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (array == nullptr || array->Length < 1)
 		{
-			ThrowBufferException("buffer");
+			ThrowBufferException("array");
 		}
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
+		int n = array->Length;
+
+		while (n > 1)
 		{
-			buffer[i] = NextFloat(minValue, maxValue);
+			n--;
+			int k = NextInteger(n + 1);
+
+			T temp = array[n];
+			array[n] = array[k];
+			array[k] = temp;
 		}
 	}
 
-	void ChaosEngine::NextFloats(array<float>^% buffer, float maxValue)
+	generic <typename T>
+	T ChaosEngine::Choose(IEnumerable<T>^ collection)
 	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (collection == nullptr)
 		{
-			ThrowBufferException("buffer");
+			ThrowBufferException("collection");
 		}
 
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
+		if (IWeighted::typeid->IsAssignableFrom(T::typeid))
+		{
+			int count = 0;
+			long long totalWeight = 0;
+
+			for each (T t in collection)
+			{
+				count++;
+				totalWeight += WeightCount(reinterpret_cast<IWeighted^>(t)->Weight);
+			}
+
+			if (count < 1)
+			{
+				ThrowBufferException("collection");
+			}
+
+			if (totalWeight < 1 || totalWeight > Int32::MaxValue)
+			{
+				ThrowWeightException("collection");
+			}
+
+			int index = ScaleSample(NextSample(), 0, static_cast<int>(totalWeight));
+
+			for each (T t in collection)
+			{
+				index -= WeightCount(reinterpret_cast<IWeighted^>(t)->Weight);
+
+				if (index < 0)
+					return t;
+			}
+
+			throw gcnew ArgumentOutOfRangeException("collection");
+		}
+
+		IList<T>^ list = dynamic_cast<IList<T>^>(collection);
+
+		if (list != nullptr)
+		{
+			if (list->Count < 1)
+			{
+				ThrowBufferException("collection");
+			}
+
+			return list[NextInteger(list->Count)];
+		}
+
+		int count = Enumerable::Count(collection);
+
+		if (count < 1)
 		{
-			buffer[i] = NextFloat(maxValue);
+			ThrowBufferException("collection");
 		}
+
+		return Enumerable::ElementAt(collection, NextInteger(count));
 	}
 
-	IEnumerable<float>^ ChaosEngine::NextFloats(int count)
+	generic <typename T>
+	void ChaosEngine::Choose(array<T>^% buffer, IEnumerable<T>^ collection)
 	{
-		if (count < 1)
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (collection == nullptr)
 		{
-			ThrowTooLowExceptionOne("count");
+			ThrowBufferException("collection");
 		}
 
 		Contract::EndContractBlock();
 
-		List<float>^ list = gcnew List<float>();
+		array<T>^ values = Enumerable::ToArray(collection);
+		array<int>^ cumulative = nullptr;
+		int range = values->Length;
 
-		for (int i = 0; i < count; i++)
+		if (values->Length < 1)
 		{
-			list->Add(NextFloat());
+			ThrowBufferException("collection");
 		}
 
-		return list;
-	}
-
-	IEnumerable<float>^ ChaosEngine::NextFloats(int count, float minValue, float maxValue)
-	{
-		if (count < 1)
+		if (IWeighted::typeid->IsAssignableFrom(T::typeid))
 		{
-			ThrowTooLowExceptionOne("count");
-		}
+			List<T>^ weightedValues = gcnew List<T>(values->Length);
+			List<int>^ cumulativeWeights = gcnew List<int>(values->Length);
+			long long totalWeight = 0;
 
-		Contract::EndContractBlock();
+			for each (T t in values)
+			{
+				int weight = WeightCount(reinterpret_cast<IWeighted^>(t)->Weight);
+
+				if (weight > 0)
+				{
+					totalWeight += weight;
 
-		List<float>^ list = gcnew List<float>();
+					if (totalWeight > Int32::MaxValue)
+					{
+						ThrowWeightException("collection");
+					}
 
-		for (int i = 0; i < count; i++)
-		{
-			list->Add(NextFloat(minValue, maxValue));
+					weightedValues->Add(t);
+					cumulativeWeights->Add(static_cast<int>(totalWeight));
+				}
+			}
+
+			if (totalWeight < 1)
+			{
+				ThrowWeightException("collection");
+			}
+
+			values = weightedValues->ToArray();
+			cumulative = cumulativeWeights->ToArray();
+			range = static_cast<int>(totalWeight);
 		}
 
-		return list;
+		ScaledIntegerConverter converter = { 0, range };
+		int indices[SampleChunk];
+
+		for (int offset = 0; offset < buffer->Length; offset += SampleChunk)
+		{
+			int count = Math::Min(SampleChunk, buffer->Length - offset);
+			NextValues<int>(indices, count, converter);
+
+			for (int i = 0; i < count; i++)
+			{
+				int index = cumulative == nullptr ? indices[i] : FindWeightedIndex(cumulative, indices[i]);
+				buffer[offset + i] = values[index];
+			}
+		}
 	}
 
-	IEnumerable<float>^ ChaosEngine::NextFloats(int count, float maxValue)
+	generic <typename T>
+	IEnumerable<T>^ ChaosEngine::Choose(int count, IEnumerable<T>^ collection)
 	{
 		if (count < 1)
 		{
 			ThrowTooLowExceptionOne("count");
 		}
 
-		Contract::EndContractBlock();
-
-		List<float>^ list = gcnew List<float>();
-
-		for (int i = 0; i < count; i++)
+		if (collection == nullptr)
 		{
-			list->Add(NextFloat(maxValue));
+			ThrowBufferException("collection");
 		}
 
-		return list;
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<T>(gcnew Func<T>(gcnew ChoiceGenerator<T>(this, collection), &ChoiceGenerator<T>::Next), count);
+
+		array<T>^ values = gcnew array<T>(count);
+		Choose(values, collection);
+		return values;
 	}
 
 	generic <typename T>
-	void ChaosEngine::Shuffle(IList<T>^% list)
+	T ChaosEngine::Choose(IEnumerable<IWeightedObject<T>^>^ collection)
 	{
-		if (list == nullptr || list->Count < 1)
+		if (collection == nullptr)
 		{
-			ThrowBufferException("list");
+			ThrowBufferException("collection");
 		}
 
 		Contract::EndContractBlock();
 
-		int n = list->Count;
+		int count = 0;
+		long long totalWeight = 0;
 
-		while (n > 1)
+		for each (IWeightedObject<T>^ t in collection)
 		{
-			n--;
-			int k = NextInteger(n + 1);
-
-			T temp = list[n];
-			list[n] = list[k];
-			list[k] = temp;
+			count++;
+			totalWeight += WeightCount(t->Weight);
 		}
-	}
 
-	generic <typename T>
-	void ChaosEngine::Shuffle(array<T>^% array)
-	{
-		if (array == nullptr || array->Length < 1)
+		if (count < 1)
 		{
-			ThrowBufferException("array");
+			ThrowBufferException("collection");
 		}
 
-		Contract::EndContractBlock();
+		if (totalWeight < 1 || totalWeight > Int32::MaxValue)
+		{
+			ThrowWeightException("collection");
+		}
 
-		int n = array->Length;
+		int index = ScaleSample(NextSample(), 0, static_cast<int>(totalWeight));
 
-		while (n > 1)
+		for each (IWeightedObject<T>^ t in collection)
 		{
-			n--;
-			int k = NextInteger(n + 1);
+			index -= WeightCount(t->Weight);
 
-			T temp = array[n];
-			array[n] = array[k];
-			array[k] = temp;
+			if (index < 0)
+				return t->Value;
 		}
+
+		throw gcnew ArgumentOutOfRangeException("collection");
 	}
 
 	generic <typename T>
-	T ChaosEngine::Choose(IEnumerable<T>^ collection)
-	{
-		if (collection == nullptr || Enumerable::Count(collection) < 1)
+	void ChaosEngine::Choose(array<T>^% buffer, IEnumerable<IWeightedObject<T>^>^ collection) {
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (collection == nullptr)
 		{
 			ThrowBufferException("collection");
 		}
 
 		Contract::EndContractBlock();
 
-		Type^ weightedType = IWeighted::typeid;
-		Type^ genericType = T::typeid;
+		List<T>^ values = gcnew List<T>();
+		List<int>^ cumulativeWeights = gcnew List<int>();
+		int count = 0;
+		long long totalWeight = 0;
 
-		if (weightedType->IsAssignableFrom(genericType))
+		for each (IWeightedObject<T>^ t in collection)
 		{
-			List<T>^ newList = gcnew List<T>();
+			int weight = WeightCount(t->Weight);
+			count++;
 
-			for each (T t in collection)
+			if (weight > 0)
 			{
-				IWeighted^ weightedItem = reinterpret_cast<IWeighted^>(t);
+				totalWeight += weight;
 
-				for (int i = 0; i < weightedItem->Weight; i++)
+				if (totalWeight > Int32::MaxValue)
 				{
-					newList->Add(t);
+					ThrowWeightException("collection");
 				}
-			}
 
-			return newList[NextInteger(newList->Count)];
+				values->Add(t->Value);
+				cumulativeWeights->Add(static_cast<int>(totalWeight));
+			}
 		}
 
-		return Enumerable::ElementAt(collection, NextInteger(Enumerable::Count(collection)));
-	}
+		if (count < 1)
+		{
+			ThrowBufferException("collection");
+		}
 
-	generic <typename T>
-	void ChaosEngine::Choose(array<T>^% buffer, IEnumerable<T>^ collection)
-	{
-		if (buffer == nullptr || buffer->Length < 1)
+		if (totalWeight < 1)
 		{
-			ThrowBufferException("buffer");
+			ThrowWeightException("collection");
 		}
 
-		Contract::EndContractBlock();
+		array<int>^ cumulative = cumulativeWeights->ToArray();
+		ScaledIntegerConverter converter = { 0, static_cast<int>(totalWeight) };
+		int indices[SampleChunk];
 
-		for (int i = 0; i < buffer->Length; i++)
+		for (int offset = 0; offset < buffer->Length; offset += SampleChunk)
 		{
-			buffer[i] = Choose(collection);
+			int count = Math::Min(SampleChunk, buffer->Length - offset);
+			NextValues<int>(indices, count, converter);
+
+			for (int i = 0; i < count; i++)
+			{
+				buffer[offset + i] = values[FindWeightedIndex(cumulative, indices[i])];
+			}
 		}
 	}
 
 	generic <typename T>
-	IEnumerable<T>^ ChaosEngine::Choose(int count, IEnumerable<T>^ collection)
+	IEnumerable<T>^ ChaosEngine::Choose(int count, IEnumerable<IWeightedObject<T>^>^ collection)
 	{
 		if (count < 1)
 		{
 			ThrowTooLowExceptionOne("count");
 		}
 
-		Contract::EndContractBlock();
-
-		List<T>^ list = gcnew List<T>();
-
-		for (int i = 0; i < count; i++)
+		if (collection == nullptr)
 		{
-			list->Add(Choose(collection));
+			ThrowBufferException("collection");
 		}
 
-		return list;
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<T>(gcnew Func<T>(gcnew WeightedChoiceGenerator<T>(this, collection), &WeightedChoiceGenerator<T>::Next), count);
+
+		array<T>^ values = gcnew array<T>(count);
+		Choose(values, collection);
+		return values;
 	}
 
 	generic <typename T>
-	T ChaosEngine::Choose(IEnumerable<IWeightedObject<T>^>^ collection)
+	T ChaosEngine::Choose(WeightedSampler<T>^ sampler)
 	{
-		if (collection == nullptr || Enumerable::Count(collection) < 1)
+		if (sampler == nullptr)
 		{
-			ThrowBufferException("collection");
+			ThrowBufferException("sampler");
 		}
 
 		Contract::EndContractBlock();
 
-		List<T>^ newList = gcnew List<T>();
-
-		for each (IWeightedObject<T> ^ t in collection)
-		{
+		int samples[2];
 
-			for (int i = 0; i < t->Weight; i++)
-			{
-				newList->Add(t->Value);
-			}
-		}
+		LockState();
+		NextSamples(samples, 2);
+		UnlockState();
 
-		return newList[NextInteger(newList->Count)];
+		return sampler->Select(samples[0], samples[1]);
 	}
 
 	generic <typename T>
-	void ChaosEngine::Choose(array<T>^% buffer, IEnumerable<IWeightedObject<T>^>^ collection) {
+	void ChaosEngine::Choose(array<T>^% buffer, WeightedSampler<T>^ sampler)
+	{
 		if (buffer == nullptr || buffer->Length < 1)
 		{
 			ThrowBufferException("buffer");
 		}
 
+		if (sampler == nullptr)
+		{
+			ThrowBufferException("sampler");
+		}
+
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
+		int samples[SampleChunk];
+
+		LockState();
+
+		for (int offset = 0; offset < buffer->Length; offset += SampleChunk / 2)
 		{
-			buffer[i] = Choose(collection);
+			int count = Math::Min(SampleChunk / 2, buffer->Length - offset);
+			NextSamples(samples, count * 2);
+
+			for (int i = 0; i < count; i++)
+			{
+				buffer[offset + i] = sampler->Select(samples[i * 2], samples[i * 2 + 1]);
+			}
 		}
+
+		UnlockState();
 	}
 
 	generic <typename T>
-	IEnumerable<T>^ ChaosEngine::Choose(int count, IEnumerable<IWeightedObject<T>^>^ collection)
+	IEnumerable<T>^ ChaosEngine::Choose(int count, WeightedSampler<T>^ sampler)
 	{
 		if (count < 1)
 		{
 			ThrowTooLowExceptionOne("count");
 		}
 
-		Contract::EndContractBlock();
-
-		List<T>^ list = gcnew List<T>();
-
-		for (int i = 0; i < count; i++)
+		if (sampler == nullptr)
 		{
-			list->Add(Choose(collection));
+			ThrowBufferException("sampler");
 		}
 
-		return list;
+		Contract::EndContractBlock();
+
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<T>(gcnew Func<T>(gcnew SamplerChoiceGenerator<T>(this, sampler), &SamplerChoiceGenerator<T>::Next), count);
+
+		array<T>^ values = gcnew array<T>(count);
+		Choose(values, sampler);
+		return values;
 	}
 
 	generic <typename T> where T : Enum
 		T ChaosEngine::NextEnum()
 	{
-		return safe_cast<T>(Enum::ToObject(T::typeid, 0));
+		if (EnumTable<T>::TotalWeight < 1)
+		{
+			ThrowEnumWeightException(T::typeid);
+		}
+
+		Contract::EndContractBlock();
+
+		return EnumTable<T>::Values[FindWeightedIndex(EnumTable<T>::CumulativeWeights, ScaleSample(NextSample(), 0, EnumTable<T>::TotalWeight))];
 	}
 
 	generic <typename T> where T : Enum
@@ -849,11 +2719,27 @@ namespace Aurora
 			ThrowBufferException("buffer");
 		}
 
+		if (EnumTable<T>::TotalWeight < 1)
+		{
+			ThrowEnumWeightException(T::typeid);
+		}
+
 		Contract::EndContractBlock();
 
-		for (int i = 0; i < buffer->Length; i++)
+		array<T>^ values = EnumTable<T>::Values;
+		array<int>^ cumulative = EnumTable<T>::CumulativeWeights;
+		ScaledIntegerConverter converter = { 0, EnumTable<T>::TotalWeight };
+		int indices[SampleChunk];
+
+		for (int offset = 0; offset < buffer->Length; offset += SampleChunk)
 		{
-			buffer[i] = NextEnum<T>();
+			int count = Math::Min(SampleChunk, buffer->Length - offset);
+			NextValues<int>(indices, count, converter);
+
+			for (int i = 0; i < count; i++)
+			{
+				buffer[offset + i] = values[FindWeightedIndex(cumulative, indices[i])];
+			}
 		}
 	}
 
@@ -867,14 +2753,12 @@ namespace Aurora
 
 		Contract::EndContractBlock();
 
-		List<T>^ list = gcnew List<T>();
-
-		for (int i = 0; i < count; i++)
-		{
-			list->Add(NextEnum<T>());
-		}
+		if (HasOption(ChaosOptions::LazySequences))
+			return gcnew ChaosSequence<T>(gcnew Func<T>(gcnew EnumGenerator<T>(this), &EnumGenerator<T>::Next), count);
 
-		return list;
+		array<T>^ values = gcnew array<T>(count);
+		NextEnum(values);
+		return values;
 	}
 
 	int ChaosEngine::ParseSeed(String^ seed, String^% storedValue)
@@ -899,92 +2783,273 @@ namespace Aurora
 		return value;
 	}
 
+	unsigned long long ChaosEngine::ForkParent(int* samples)
+	{
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext;
+		int iNextP;
+
+		CopyRing(seedArray, _iNext, samples);
+		unsigned long long digest = DigestSamples(samples, StateLength, 0);
+
+		ForkState(samples, digest, 0, seedArray, iNext, iNextP);
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		return digest;
+	}
+
+	int ChaosEngine::DeriveSeed(int seed, int stream)
+	{
+		return Native::DeriveSeed(seed, stream);
+	}
+
+	bool ChaosEngine::HasOption(ChaosOptions option)
+	{
+		return (_options & option) == option;
+	}
+
+	void ChaosEngine::LockState()
+	{
+		if (IsSynchronized)
+			Monitor::Enter(_seedArray);
+	}
+
+	void ChaosEngine::UnlockState()
+	{
+		if (IsSynchronized)
+			Monitor::Exit(_seedArray);
+	}
+
 	void ChaosEngine::Reseed(int seed, String^ stored)
 	{
-		Monitor::Enter(_stateLock);
+		LockState();
 
 		_seed = stored;
+		_seedValue = seed;
+		_parallelFills = 0;
 
-		int subtraction = seed == std::numeric_limits<int>::min() ? std::numeric_limits<int>::max() : abs(seed);
-		int mj = SEED - subtraction;
-		_seedArray[54] = mj;
-		int mk = 1;
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext;
+		int iNextP;
 
-		for (int i = 0; i < 54; i++)
-		{
-			int ii = (42 * (i + 1) % 55) - 1;
-			_seedArray[ii] = mk;
-			mk = mj - mk;
+		ReseedState(seedArray, iNext, iNextP, seed);
 
-			if (mk < 0)
-			{
-				mk += std::numeric_limits<int>::max();
-			}
+		_iNext = iNext;
+		_iNextP = iNextP;
 
-			mj = _seedArray[ii];
-		}
+		UnlockState();
+	}
 
-		for (int k = 1; k < 5; k++)
-		{
-			for (int i = 0; i < 55; i++)
-			{
-				_seedArray[i] -= _seedArray[(i + 30) % 55];
+	int ChaosEngine::NextSample()
+	{
+		LockState();
 
-				if (_seedArray[i] < 0)
-				{
-					_seedArray[i] += std::numeric_limits<int>::max();
-				}
-			}
-		}
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		int retVal = Native::NextSample(seedArray, iNext, iNextP);
 
-		_iNext = 0;
-		_iNextP = 42;
+		_iNext = iNext;
+		_iNextP = iNextP;
 
-		Monitor::Exit(_stateLock);
+		UnlockState();
+
+		return retVal;
 	}
 
-	int ChaosEngine::NextSample()
+	void ChaosEngine::NextSamples(int* buffer, int count)
 	{
-		Monitor::Enter(_stateLock);
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
 
-		int retVal = _seedArray[_iNext] - _seedArray[_iNextP];
+		GenerateSamples(seedArray, iNext, iNextP, buffer, count);
 
-		if (retVal == std::numeric_limits<int>::max())
-		{
-			retVal--;
-		}
+		_iNext = iNext;
+		_iNextP = iNextP;
+	}
 
-		if (retVal < 0)
-		{
-			retVal = std::numeric_limits<int>::max();
-		}
+	int ChaosEngine::NextParallelSeed()
+	{
+		LockState();
 
-		_seedArray[_iNext] = retVal;
+		int samples[StateLength];
+		NextSamples(samples, StateLength);
+		unsigned long long digest = DigestSamples(samples, StateLength, _parallelFills++);
 
-		if (++_iNext >= 55)
-		{
-			_iNext = 0;
-		}
+		UnlockState();
 
-		if (++_iNextP >= 55)
-		{
-			_iNextP = 0;
-		}
+		return static_cast<int>(digest >> 32);
+	}
+
+	template <typename T, typename TConverter>
+	void ChaosEngine::NextValues(T* buffer, int length, TConverter converter)
+	{
+		LockState();
 
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
 
-		Monitor::Exit(_stateLock);
+		GenerateValues<T>(seedArray, iNext, iNextP, buffer, length, converter);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+	}
+
+	template <typename T>
+	void ChaosEngine::NextPackedValues(T* buffer, int length, int bitsPerValue)
+	{
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		GeneratePackedValues<T>(seedArray, iNext, iNextP, buffer, length, bitsPerValue);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+	}
+
+	template <typename T, typename TConverter>
+	void ChaosEngine::NextPairedValues(T* buffer, int length, TConverter converter)
+	{
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		GeneratePairedValues<T>(seedArray, iNext, iNextP, buffer, length, converter);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+	}
+
+	template <typename T, typename TDistribution>
+	void ChaosEngine::NextDistributionValues(T* buffer, int length, const TDistribution& distribution)
+	{
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		GenerateDistributionValues<T>(seedArray, iNext, iNextP, buffer, length, distribution);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+	}
+
+	void ChaosEngine::NextSparseProbabilities(bool* buffer, int length, double percent)
+	{
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		GenerateSparseProbabilities(seedArray, iNext, iNextP, buffer, length, percent);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+	}
+
+	unsigned long long ChaosEngine::NextWideInteger(unsigned long long range)
+	{
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		unsigned long long retVal = Native::NextWideInteger(seedArray, iNext, iNextP, range);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
 
 		return retVal;
 	}
 
-	float ChaosEngine::NextRange(bool inclusive)
+	template <typename T>
+	void ChaosEngine::NextWideValues(T* buffer, int length, unsigned long long minValue, unsigned long long range)
+	{
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		GenerateWideValues<T>(seedArray, iNext, iNextP, buffer, length, minValue, range);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+	}
+
+	int ChaosEngine::NextPreciseInteger(int minValue, int maxValue)
+	{
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		int retVal = Native::NextPreciseInteger(seedArray, iNext, iNextP, minValue, maxValue);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+
+		return retVal;
+	}
+
+	template <typename T>
+	void ChaosEngine::NextPreciseValues(T* buffer, int length, int minValue, int maxValue)
+	{
+		LockState();
+
+		pin_ptr<int> seedArray = &_seedArray[0];
+		int iNext = _iNext;
+		int iNextP = _iNextP;
+
+		GeneratePreciseValues<T>(seedArray, iNext, iNextP, buffer, length, minValue, maxValue);
+
+		_iNext = iNext;
+		_iNextP = iNextP;
+
+		UnlockState();
+	}
+
+	template <typename T, typename TConverter>
+	void ChaosEngine::NextValuesParallel(T* buffer, int length, TConverter converter)
 	{
-		int sample = NextSample();
-		int max = std::numeric_limits<int>::max();
+		int seed = NextParallelSeed();
+		int chunks = (length - 1) / ParallelChunk + 1;
 
-		if (inclusive)
-			max -= 1;
+		ParallelFill<T, TConverter>^ fill = gcnew ParallelFill<T, TConverter>(buffer, length, seed, &converter);
+		Parallel::For(0, chunks, gcnew Action<int>(fill, &ParallelFill<T, TConverter>::FillChunk));
+	}
 
-		return sample * (1.0f / max);
+	float ChaosEngine::NextRange(bool inclusive)
+	{
+		return SampleToRange(NextSample(), inclusive);
 	}
 }
@@ -1,9 +1,57 @@
 #pragma once
 
 #include "IWeightedObject.h"
+#include "WeightedSampler.h"
 
 namespace Aurora
 {
+	/// <summary>
+	/// Specifies options that control how a chaos engine generates values.
+	/// </summary>
+	[System::Flags]
+	public enum class ChaosOptions
+	{
+		/// <summary>
+		/// The default options. The engine locks its state and produces the reference sequence.
+		/// </summary>
+		None = 0,
+
+		/// <summary>
+		/// The engine does not lock its state. It must only be used by one thread at a time.
+		/// </summary>
+		Unsynchronized = 1,
+
+		/// <summary>
+		/// Full range byte buffers are filled with all 31 bits of every sample instead of one sample per byte.
+		/// This changes the generated bytes, so engines that must reproduce existing sequences should not use it.
+		/// </summary>
+		PackedBytes = 2,
+
+		/// <summary>
+		/// Boolean buffers are filled with one bit of a sample per value instead of one sample per value.
+		/// This changes the generated booleans, so engines that must reproduce existing sequences should not use it.
+		/// </summary>
+		PackedBooleans = 4,
+
+		/// <summary>
+		/// Methods returning a number of values generate each value while the result is enumerated instead of up front.
+		/// Every enumeration of the result generates new values, one at a time, so the packed options do not apply to it.
+		/// </summary>
+		LazySequences = 8,
+
+		/// <summary>
+		/// Integers and bytes within a range, and the choices and shuffles built on them, are drawn with Lemire's multiply and reject method instead of a float scale.
+		/// Every value of a range is then equally likely and reachable, even for ranges above 2^24, but the generated values differ from the reference sequence.
+		/// </summary>
+		PreciseIntegers = 16,
+
+		/// <summary>
+		/// Probability buffers with a probability up to 12.5% are filled by drawing the gaps between the true values, taking one sample per true value instead of one per value.
+		/// This changes the generated booleans, so engines that must reproduce existing sequences should not use it.
+		/// </summary>
+		SparseProbabilities = 32,
+	};
+
 	/// <summary>
 	/// Represents a chaos engine for generating random numbers and performing random operations.
 	/// </summary>
@@ -21,6 +69,22 @@ namespace Aurora
 		/// </summary>
 		static property ChaosEngine^ Shared { ChaosEngine^ get(); void set(ChaosEngine^ engine); }
 
+		/// <summary>
+		/// Gets the chaos engine owned by the calling thread.
+		/// The engine is unsynchronized and seeded from the seed of the shared instance and the managed thread id.
+		/// </summary>
+		static property ChaosEngine^ ThreadLocal { ChaosEngine^ get(); }
+
+		/// <summary>
+		/// Gets the options the chaos engine was created with.
+		/// </summary>
+		property ChaosOptions Options { ChaosOptions get(); }
+
+		/// <summary>
+		/// Gets a value indicating whether access to the chaos engine is synchronized.
+		/// </summary>
+		property bool IsSynchronized { bool get(); }
+
 		/// <summary>
 		/// Initializes a new instance of the ChaosEngine class with the default seed.
 		/// </summary>
@@ -38,6 +102,42 @@ namespace Aurora
 		/// <param name="seed">The seed value as an integer.</param>
 		ChaosEngine(int seed);
 
+		/// <summary>
+		/// Initializes a new instance of the ChaosEngine class with the default seed and the specified options.
+		/// </summary>
+		/// <param name="options">The options of the chaos engine.</param>
+		ChaosEngine(ChaosOptions options);
+
+		/// <summary>
+		/// Initializes a new instance of the ChaosEngine class with the specified seed as a string and the specified options.
+		/// </summary>
+		/// <param name="seed">The seed value as a string.</param>
+		/// <param name="options">The options of the chaos engine.</param>
+		ChaosEngine(System::String^ seed, ChaosOptions options);
+
+		/// <summary>
+		/// Initializes a new instance of the ChaosEngine class with the specified seed as an integer and the specified options.
+		/// </summary>
+		/// <param name="seed">The seed value as an integer.</param>
+		/// <param name="options">The options of the chaos engine.</param>
+		ChaosEngine(int seed, ChaosOptions options);
+
+		/// <summary>
+		/// Creates an independent child chaos engine from the current state of this one.
+		/// The child's state is a copy of this chaos engine's state masked with a keystream keyed by a digest of it, which takes about half the time of seeding a new chaos engine.
+		/// This chaos engine is re-keyed the same way, so repeated forks never give related children.
+		/// The child has the same options and a seed derived from this one; resetting the child reseeds it from that seed instead of returning to the fork.
+		/// </summary>
+		/// <returns>The child chaos engine.</returns>
+		ChaosEngine^ Fork();
+
+		/// <summary>
+		/// Creates independent child chaos engines from the current state of this one and stores them in the buffer, taking the state lock once.
+		/// The state is digested once and every child applies its own mask, so each child beyond the first costs little more than its allocation.
+		/// </summary>
+		/// <param name="children">The buffer to store the child chaos engines.</param>
+		void Fork(array<ChaosEngine^>^% children);
+
 		/// <summary>
 		/// Resets the chaos engine to its initial state.
 		/// </summary>
@@ -60,6 +160,54 @@ namespace Aurora
 		/// <param name="seed">The seed value as an integer.</param>
 		void Reseed(int seed);
 
+		/// <summary>
+		/// Advances the chaos engine past the specified number of random samples, as if that many values had been generated one sample at a time.
+		/// The samples are still computed, but in large vectorized blocks under a single lock, which is far faster than generating them.
+		/// </summary>
+		/// <param name="count">The number of random samples to skip.</param>
+		void Discard(long long count);
+
+		/// <summary>
+		/// The number of bytes in a state saved by SaveState.
+		/// </summary>
+		literal int StateSize = 236;
+
+		/// <summary>
+		/// Saves the current state of the chaos engine in a new buffer of StateSize bytes.
+		/// </summary>
+		/// <returns>The saved state.</returns>
+		array<unsigned char>^ SaveState();
+
+		/// <summary>
+		/// Saves the current state of the chaos engine in the buffer.
+		/// The state is a fixed size, versioned little endian layout that can be copied and stored as is, and restored by LoadState.
+		/// </summary>
+		/// <param name="buffer">The buffer of at least StateSize bytes to store the state.</param>
+		void SaveState(array<unsigned char>^% buffer);
+
+		/// <summary>
+		/// Saves the current state of the chaos engine in the buffer.
+		/// The state is a fixed size, versioned little endian layout that can be copied and stored as is, and restored by LoadState.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the state.</param>
+		/// <param name="length">The length of the buffer, at least StateSize bytes.</param>
+		void SaveState(unsigned char* buffer, int length);
+
+		/// <summary>
+		/// Restores a state saved by SaveState.
+		/// The seed of the chaos engine becomes the integer seed of the saved state, so Reset returns to the start of the same sequence.
+		/// </summary>
+		/// <param name="state">The saved state.</param>
+		void LoadState(array<unsigned char>^ state);
+
+		/// <summary>
+		/// Restores a state saved by SaveState.
+		/// The seed of the chaos engine becomes the integer seed of the saved state, so Reset returns to the start of the same sequence.
+		/// </summary>
+		/// <param name="state">A pointer to the saved state.</param>
+		/// <param name="length">The length of the saved state, at least StateSize bytes.</param>
+		void LoadState(const unsigned char* state, int length);
+
 		/// <summary>
 		/// Generates the next random boolean value.
 		/// </summary>
@@ -68,17 +216,47 @@ namespace Aurora
 
 		/// <summary>
 		/// Generates the next random boolean values and stores them in the specified buffer.
+		/// If the engine has the PackedBooleans option, every sample supplies 31 values.
 		/// </summary>
 		/// <param name="buffer">The buffer to store the random boolean values.</param>
 		void NextBooleans(array<bool>^% buffer);
 
+		/// <summary>
+		/// Generates the next random boolean values and stores them in the specified buffer.
+		/// If the engine has the PackedBooleans option, every sample supplies 31 values.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random boolean values.</param>
+		/// <param name="length">The number of random boolean values to generate.</param>
+		void NextBooleans(bool* buffer, int length);
+
 		/// <summary>
 		/// Generates the specified number of random boolean values.
+		/// If the engine has the PackedBooleans option, every sample supplies 31 values.
 		/// </summary>
 		/// <param name="count">The number of random boolean values to generate.</param>
 		/// <returns>An enumerable collection of random boolean values.</returns>
 		System::Collections::Generic::IEnumerable<bool>^ NextBooleans(int count);
 
+		/// <summary>
+		/// Generates the specified number of random bits, every sample supplying 31 of them.
+		/// </summary>
+		/// <param name="count">The number of random bits to generate.</param>
+		/// <returns>A bit array containing the random bits.</returns>
+		System::Collections::BitArray^ NextBits(int count);
+
+		/// <summary>
+		/// Generates random bits and stores them in the specified buffer, every sample supplying 31 of them.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random bits, 64 per element.</param>
+		void NextBits(array<unsigned long long>^% buffer);
+
+		/// <summary>
+		/// Generates random bits and stores them in the specified buffer, every sample supplying 31 of them.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random bits, 64 per element.</param>
+		/// <param name="length">The number of elements in the buffer.</param>
+		void NextBits(unsigned long long* buffer, int length);
+
 		/// <summary>
 		/// Generates a random boolean value based on the specified probability in percentage.
 		/// </summary>
@@ -86,6 +264,13 @@ namespace Aurora
 		/// <returns>A random boolean value based on the specified probability.</returns>
 		bool NextProbability(float percent);
 
+		/// <summary>
+		/// Generates a random boolean value based on the specified probability, compared against a 53-bit random double.
+		/// </summary>
+		/// <param name="percent">The probability value between 0.0 and 1.0.</param>
+		/// <returns>A random boolean value based on the specified probability.</returns>
+		bool NextProbability(double percent);
+
 		/// <summary>
 		/// Generates a random boolean value based on the specified probability in percentage.
 		/// </summary>
@@ -100,6 +285,14 @@ namespace Aurora
 		/// <param name="percent">The probability value in percentage (0-100).</param>
 		void NextProbabilities(array<bool>^% buffer, float percent);
 
+		/// <summary>
+		/// Generates the next random boolean values based on the specified probability in percentage and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random boolean values.</param>
+		/// <param name="length">The number of random boolean values to generate.</param>
+		/// <param name="percent">The probability value in percentage (0-100).</param>
+		void NextProbabilities(bool* buffer, int length, float percent);
+
 		/// <summary>
 		/// Generates the next random boolean values based on the specified probability in percentage and stores them in the buffer.
 		/// </summary>
@@ -107,6 +300,14 @@ namespace Aurora
 		/// <param name="percent">The probability value in percentage (0-100).</param>
 		void NextProbabilities(array<bool>^% buffer, int percent);
 
+		/// <summary>
+		/// Generates the next random boolean values based on the specified probability in percentage and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random boolean values.</param>
+		/// <param name="length">The number of random boolean values to generate.</param>
+		/// <param name="percent">The probability value in percentage (0-100).</param>
+		void NextProbabilities(bool* buffer, int length, int percent);
+
 		/// <summary>
 		/// Generates the specified number of random boolean values based on the specified probability in percentage.
 		/// </summary>
@@ -123,6 +324,15 @@ namespace Aurora
 		/// <returns>An enumerable collection of random boolean values based on the specified probability.</returns>
 		System::Collections::Generic::IEnumerable<bool>^ NextProbabilities(int count, int percent);
 
+		/// <summary>
+		/// Generates a sequence of random boolean values with the specified probability of being true and returns the indices of the true values.
+		/// The gaps between the true values are drawn directly, so the work depends on the number of true values rather than the length of the sequence.
+		/// </summary>
+		/// <param name="length">The number of values of the sequence.</param>
+		/// <param name="percent">The probability of being true, between 0 and 1.</param>
+		/// <returns>The indices of the true values in ascending order.</returns>
+		array<int>^ NextProbabilityIndices(int length, float percent);
+
 		/// <summary>
 		/// Generates a random boolean value based on the specified odds.
 		/// </summary>
@@ -139,6 +349,15 @@ namespace Aurora
 		/// <param name="b">The denominator of the odds.</param>
 		void NextOdds(array<bool>^% buffer, int a, int b);
 
+		/// <summary>
+		/// Generates the next random boolean values based on the specified odds and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random boolean values.</param>
+		/// <param name="length">The number of random boolean values to generate.</param>
+		/// <param name="a">The numerator of the odds.</param>
+		/// <param name="b">The denominator of the odds.</param>
+		void NextOdds(bool* buffer, int length, int a, int b);
+
 		/// <summary>
 		/// Generates the specified number of random boolean values based on the specified odds.
 		/// </summary>
@@ -164,6 +383,15 @@ namespace Aurora
 		/// <param name="b">The denominator of the odds.</param>
 		void NextOdds(array<bool>^% buffer, float a, float b);
 
+		/// <summary>
+		/// Generates the next random boolean values based on the specified odds and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random boolean values.</param>
+		/// <param name="length">The number of random boolean values to generate.</param>
+		/// <param name="a">The numerator of the odds.</param>
+		/// <param name="b">The denominator of the odds.</param>
+		void NextOdds(bool* buffer, int length, float a, float b);
+
 		/// <summary>
 		/// Generates the specified number of random boolean values based on the specified odds.
 		/// </summary>
@@ -173,6 +401,50 @@ namespace Aurora
 		/// <returns>An enumerable collection of random boolean values based on the specified odds.</returns>
 		System::Collections::Generic::IEnumerable<bool>^ NextOdds(int count, float a, float b);
 
+		/// <summary>
+		/// Generates the number of true values among the specified number of random boolean values based on the specified probability, without generating the values.
+		/// The number is drawn from the binomial distribution in expected constant time, whatever the number of trials.
+		/// </summary>
+		/// <param name="trials">The number of boolean values.</param>
+		/// <param name="percent">The probability value (0-1).</param>
+		/// <returns>A random number of true values within the range [0, trials].</returns>
+		int NextBinomial(int trials, float percent);
+
+		/// <summary>
+		/// Generates the number of true values among the specified number of random boolean values based on the specified probability in percentage, without generating the values.
+		/// </summary>
+		/// <param name="trials">The number of boolean values.</param>
+		/// <param name="percent">The probability value in percentage (0-100).</param>
+		/// <returns>A random number of true values within the range [0, trials].</returns>
+		int NextBinomial(int trials, int percent);
+
+		/// <summary>
+		/// Generates the number of true values among the specified number of random boolean values based on the specified odds, without generating the values.
+		/// </summary>
+		/// <param name="trials">The number of boolean values.</param>
+		/// <param name="a">The numerator of the odds.</param>
+		/// <param name="b">The denominator of the odds.</param>
+		/// <returns>A random number of true values within the range [0, trials].</returns>
+		int NextBinomial(int trials, int a, int b);
+
+		/// <summary>
+		/// Generates the number of true values among the specified number of random boolean values based on the specified odds, without generating the values.
+		/// </summary>
+		/// <param name="trials">The number of boolean values.</param>
+		/// <param name="a">The numerator of the odds.</param>
+		/// <param name="b">The denominator of the odds.</param>
+		/// <returns>A random number of true values within the range [0, trials].</returns>
+		int NextBinomial(int trials, float a, float b);
+
+		/// <summary>
+		/// Distributes the specified number of trials over outcomes with the specified weights and returns the number of trials of every outcome.
+		/// The counts are drawn as one binomial value per outcome, whatever the number of trials.
+		/// </summary>
+		/// <param name="trials">The number of trials.</param>
+		/// <param name="weights">The weights of the outcomes. Outcomes with a weight that is not greater than zero are never chosen.</param>
+		/// <returns>The number of trials of every outcome, in the order of the weights.</returns>
+		array<int>^ NextMultinomial(int trials, array<double>^ weights);
+
 		/// <summary>
 		/// Generates the next random byte value.
 		/// </summary>
@@ -196,10 +468,19 @@ namespace Aurora
 
 		/// <summary>
 		/// Generates the next random byte values and stores them in the specified buffer.
+		/// If the engine has the PackedBytes option, every sample supplies 31 bits of the buffer.
 		/// </summary>
 		/// <param name="buffer">The buffer to store the random byte values.</param>
 		void NextBytes(array<unsigned char>^% buffer);
 
+		/// <summary>
+		/// Generates the next random byte values and stores them in the specified buffer.
+		/// If the engine has the PackedBytes option, every sample supplies 31 bits of the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random byte values.</param>
+		/// <param name="length">The number of random byte values to generate.</param>
+		void NextBytes(unsigned char* buffer, int length);
+
 		/// <summary>
 		/// Generates the next random byte values within the specified range and stores them in the specified buffer.
 		/// </summary>
@@ -208,6 +489,15 @@ namespace Aurora
 		/// <param name="maxValue">The maximum value of the random byte (inclusive).</param>
 		void NextBytes(array<unsigned char>^% buffer, unsigned char minValue, unsigned char maxValue);
 
+		/// <summary>
+		/// Generates the next random byte values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random byte values.</param>
+		/// <param name="length">The number of random byte values to generate.</param>
+		/// <param name="minValue">The minimum value of the random byte (inclusive).</param>
+		/// <param name="maxValue">The maximum value of the random byte (inclusive).</param>
+		void NextBytes(unsigned char* buffer, int length, unsigned char minValue, unsigned char maxValue);
+
 		/// <summary>
 		/// Generates the next random byte values within the specified range and stores them in the specified buffer.
 		/// </summary>
@@ -215,8 +505,17 @@ namespace Aurora
 		/// <param name="maxValue">The maximum value of the random byte (inclusive).</param>
 		void NextBytes(array<unsigned char>^% buffer, unsigned char maxValue);
 
+		/// <summary>
+		/// Generates the next random byte values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random byte values.</param>
+		/// <param name="length">The number of random byte values to generate.</param>
+		/// <param name="maxValue">The maximum value of the random byte (inclusive).</param>
+		void NextBytes(unsigned char* buffer, int length, unsigned char maxValue);
+
 		/// <summary>
 		/// Generates the specified number of random byte values.
+		/// If the engine has the PackedBytes option, every sample supplies 31 bits of the values.
 		/// </summary>
 		/// <param name="count">The number of random byte values to generate.</param>
 		/// <returns>An enumerable collection of random byte values.</returns>
@@ -266,6 +565,13 @@ namespace Aurora
 		/// <param name="buffer">The buffer to store the random integer values.</param>
 		void NextIntegers(array<int>^% buffer);
 
+		/// <summary>
+		/// Generates the next random integer values and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of random integer values to generate.</param>
+		void NextIntegers(int* buffer, int length);
+
 		/// <summary>
 		/// Generates the next random integer values within the specified range and stores them in the specified buffer.
 		/// </summary>
@@ -274,6 +580,15 @@ namespace Aurora
 		/// <param name="maxValue">The maximum value of the random integer (exclusive).</param>
 		void NextIntegers(array<int>^% buffer, int minValue, int maxValue);
 
+		/// <summary>
+		/// Generates the next random integer values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of random integer values to generate.</param>
+		/// <param name="minValue">The minimum value of the random integer (inclusive).</param>
+		/// <param name="maxValue">The maximum value of the random integer (exclusive).</param>
+		void NextIntegers(int* buffer, int length, int minValue, int maxValue);
+
 		/// <summary>
 		/// Generates the next random integer values within the specified range and stores them in the specified buffer.
 		/// </summary>
@@ -281,6 +596,14 @@ namespace Aurora
 		/// <param name="maxValue">The maximum value of the random integer (exclusive).</param>
 		void NextIntegers(array<int>^% buffer, int maxValue);
 
+		/// <summary>
+		/// Generates the next random integer values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of random integer values to generate.</param>
+		/// <param name="maxValue">The maximum value of the random integer (exclusive).</param>
+		void NextIntegers(int* buffer, int length, int maxValue);
+
 		/// <summary>
 		/// Generates the specified number of random integer values.
 		/// </summary>
@@ -305,6 +628,44 @@ namespace Aurora
 		/// <returns>An enumerable collection of random integer values within the specified range.</returns>
 		System::Collections::Generic::IEnumerable<int>^ NextIntegers(int count, int maxValue);
 
+		/// <summary>
+		/// Generates random integer values on multiple threads and stores them in the buffer.
+		/// The buffer is split into fixed chunks, each filled from its own stream derived from a digest of the next 55 samples of the chaos engine and the number of parallel fills since it was seeded or its state was loaded.
+		/// The values are the same on any number of processors, but differ from the values NextIntegers generates.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random integer values.</param>
+		void NextIntegersParallel(array<int>^% buffer);
+
+		/// <summary>
+		/// Generates random integer values on multiple threads and stores them in the buffer.
+		/// The buffer is split into fixed chunks, each filled from its own stream derived from a digest of the next 55 samples of the chaos engine and the number of parallel fills since it was seeded or its state was loaded.
+		/// The values are the same on any number of processors, but differ from the values NextIntegers generates.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		void NextIntegersParallel(int* buffer, int length);
+
+		/// <summary>
+		/// Generates random integer values within the range [minValue, maxValue) on multiple threads and stores them in the buffer.
+		/// The buffer is split into fixed chunks, each filled from its own stream derived from a digest of the next 55 samples of the chaos engine and the number of parallel fills since it was seeded or its state was loaded.
+		/// The values are the same on any number of processors, but differ from the values NextIntegers generates.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random integer values.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextIntegersParallel(array<int>^% buffer, int minValue, int maxValue);
+
+		/// <summary>
+		/// Generates random integer values within the range [minValue, maxValue) on multiple threads and stores them in the buffer.
+		/// The buffer is split into fixed chunks, each filled from its own stream derived from a digest of the next 55 samples of the chaos engine and the number of parallel fills since it was seeded or its state was loaded.
+		/// The values are the same on any number of processors, but differ from the values NextIntegers generates.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextIntegersParallel(int* buffer, int length, int minValue, int maxValue);
+
 		/// <summary>
 		/// Generates the next random float value between 0.0 (inclusive) and 1.0 (exclusive).
 		/// </summary>
@@ -332,6 +693,13 @@ namespace Aurora
 		/// <param name="buffer">The buffer to store the random float values.</param>
 		void NextFloats(array<float>^% buffer);
 
+		/// <summary>
+		/// Generates the next random float values and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random float values.</param>
+		/// <param name="length">The number of random float values to generate.</param>
+		void NextFloats(float* buffer, int length);
+
 		/// <summary>
 		/// Generates the next random float values within the specified range and stores them in the specified buffer.
 		/// </summary>
@@ -340,6 +708,15 @@ namespace Aurora
 		/// <param name="maxValue">The maximum value of the random float (exclusive).</param>
 		void NextFloats(array<float>^% buffer, float minValue, float maxValue);
 
+		/// <summary>
+		/// Generates the next random float values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random float values.</param>
+		/// <param name="length">The number of random float values to generate.</param>
+		/// <param name="minValue">The minimum value of the random float (inclusive).</param>
+		/// <param name="maxValue">The maximum value of the random float (exclusive).</param>
+		void NextFloats(float* buffer, int length, float minValue, float maxValue);
+
 		/// <summary>
 		/// Generates the next random float values within the specified range and stores them in the specified buffer.
 		/// </summary>
@@ -347,6 +724,14 @@ namespace Aurora
 		/// <param name="maxValue">The maximum value of the random float (exclusive).</param>
 		void NextFloats(array<float>^% buffer, float maxValue);
 
+		/// <summary>
+		/// Generates the next random float values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random float values.</param>
+		/// <param name="length">The number of random float values to generate.</param>
+		/// <param name="maxValue">The maximum value of the random float (exclusive).</param>
+		void NextFloats(float* buffer, int length, float maxValue);
+
 		/// <summary>
 		/// Generates the specified number of random float values.
 		/// </summary>
@@ -371,6 +756,354 @@ namespace Aurora
 		/// <returns>An enumerable collection of random float values within the specified range.</returns>
 		System::Collections::Generic::IEnumerable<float>^ NextFloats(int count, float maxValue);
 
+		/// <summary>
+		/// Generates the next random double value between 0.0 (inclusive) and 1.0 (exclusive).
+		/// Two samples are combined into a full 53-bit mantissa, so every multiple of 2^-53 in the range can be generated.
+		/// </summary>
+		/// <returns>A random double value.</returns>
+		double NextDouble();
+
+		/// <summary>
+		/// Generates the next random double value within the specified range.
+		/// </summary>
+		/// <param name="minValue">The minimum value of the random double (inclusive).</param>
+		/// <param name="maxValue">The maximum value of the random double (exclusive).</param>
+		/// <returns>A random double value within the specified range.</returns>
+		double NextDouble(double minValue, double maxValue);
+
+		/// <summary>
+		/// Generates the next random double value within the specified range.
+		/// </summary>
+		/// <param name="maxValue">The maximum value of the random double (exclusive).</param>
+		/// <returns>A random double value within the specified range.</returns>
+		double NextDouble(double maxValue);
+
+		/// <summary>
+		/// Generates the next random double values and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random double values.</param>
+		void NextDoubles(array<double>^% buffer);
+
+		/// <summary>
+		/// Generates the next random double values and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random double values.</param>
+		/// <param name="length">The number of random double values to generate.</param>
+		void NextDoubles(double* buffer, int length);
+
+		/// <summary>
+		/// Generates the next random double values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random double values.</param>
+		/// <param name="minValue">The minimum value of the random double (inclusive).</param>
+		/// <param name="maxValue">The maximum value of the random double (exclusive).</param>
+		void NextDoubles(array<double>^% buffer, double minValue, double maxValue);
+
+		/// <summary>
+		/// Generates the next random double values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random double values.</param>
+		/// <param name="length">The number of random double values to generate.</param>
+		/// <param name="minValue">The minimum value of the random double (inclusive).</param>
+		/// <param name="maxValue">The maximum value of the random double (exclusive).</param>
+		void NextDoubles(double* buffer, int length, double minValue, double maxValue);
+
+		/// <summary>
+		/// Generates the next random double values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random double values.</param>
+		/// <param name="maxValue">The maximum value of the random double (exclusive).</param>
+		void NextDoubles(array<double>^% buffer, double maxValue);
+
+		/// <summary>
+		/// Generates the next random double values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random double values.</param>
+		/// <param name="length">The number of random double values to generate.</param>
+		/// <param name="maxValue">The maximum value of the random double (exclusive).</param>
+		void NextDoubles(double* buffer, int length, double maxValue);
+
+		/// <summary>
+		/// Generates the specified number of random double values.
+		/// </summary>
+		/// <param name="count">The number of random double values to generate.</param>
+		/// <returns>An enumerable collection of random double values.</returns>
+		System::Collections::Generic::IEnumerable<double>^ NextDoubles(int count);
+
+		/// <summary>
+		/// Generates the specified number of random double values within the specified range.
+		/// </summary>
+		/// <param name="count">The number of random double values to generate.</param>
+		/// <param name="minValue">The minimum value of the random double (inclusive).</param>
+		/// <param name="maxValue">The maximum value of the random double (exclusive).</param>
+		/// <returns>An enumerable collection of random double values within the specified range.</returns>
+		System::Collections::Generic::IEnumerable<double>^ NextDoubles(int count, double minValue, double maxValue);
+
+		/// <summary>
+		/// Generates the specified number of random double values within the specified range.
+		/// </summary>
+		/// <param name="count">The number of random double values to generate.</param>
+		/// <param name="maxValue">The maximum value of the random double (exclusive).</param>
+		/// <returns>An enumerable collection of random double values within the specified range.</returns>
+		System::Collections::Generic::IEnumerable<double>^ NextDoubles(int count, double maxValue);
+
+		/// <summary>
+		/// Generates the next random 64-bit integer value.
+		/// Three samples are combined for every value.
+		/// </summary>
+		/// <returns>A random integer value within the range [0, 9223372036854775807].</returns>
+		long long NextInt64();
+
+		/// <summary>
+		/// Generates the next random 64-bit integer value within the specified range.
+		/// Every value of the range is equally likely, for ranges of any size up to the full 64-bit range.
+		/// </summary>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		/// <returns>A random integer value within the specified range.</returns>
+		long long NextInt64(long long minValue, long long maxValue);
+
+		/// <summary>
+		/// Generates the next random 64-bit integer value within the specified range.
+		/// </summary>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		/// <returns>A random integer value within the specified range.</returns>
+		long long NextInt64(long long maxValue);
+
+		/// <summary>
+		/// Generates the next random 64-bit integer values and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random integer values.</param>
+		void NextInt64s(array<long long>^% buffer);
+
+		/// <summary>
+		/// Generates the next random 64-bit integer values and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of random integer values to generate.</param>
+		void NextInt64s(long long* buffer, int length);
+
+		/// <summary>
+		/// Generates the next random 64-bit integer values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random integer values.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextInt64s(array<long long>^% buffer, long long minValue, long long maxValue);
+
+		/// <summary>
+		/// Generates the next random 64-bit integer values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of random integer values to generate.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextInt64s(long long* buffer, int length, long long minValue, long long maxValue);
+
+		/// <summary>
+		/// Generates the next random 64-bit integer values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random integer values.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextInt64s(array<long long>^% buffer, long long maxValue);
+
+		/// <summary>
+		/// Generates the next random 64-bit integer values within the specified range and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of random integer values to generate.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextInt64s(long long* buffer, int length, long long maxValue);
+
+		/// <summary>
+		/// Generates the specified number of random 64-bit integer values.
+		/// </summary>
+		/// <param name="count">The number of random integer values to generate.</param>
+		/// <returns>An enumerable collection of random integer values.</returns>
+		System::Collections::Generic::IEnumerable<long long>^ NextInt64s(int count);
+
+		/// <summary>
+		/// Generates the specified number of random 64-bit integer values within the specified range.
+		/// </summary>
+		/// <param name="count">The number of random integer values to generate.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		/// <returns>An enumerable collection of random integer values within the specified range.</returns>
+		System::Collections::Generic::IEnumerable<long long>^ NextInt64s(int count, long long minValue, long long maxValue);
+
+		/// <summary>
+		/// Generates the specified number of random 64-bit integer values within the specified range.
+		/// </summary>
+		/// <param name="count">The number of random integer values to generate.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		/// <returns>An enumerable collection of random integer values within the specified range.</returns>
+		System::Collections::Generic::IEnumerable<long long>^ NextInt64s(int count, long long maxValue);
+
+		/// <summary>
+		/// Generates the next random unsigned 64-bit integer value, using all 64 bits.
+		/// </summary>
+		/// <returns>A random integer value within the range [0, 18446744073709551615].</returns>
+		unsigned long long NextUInt64();
+
+		/// <summary>
+		/// Generates the next random unsigned 64-bit integer values and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random integer values.</param>
+		void NextUInt64s(array<unsigned long long>^% buffer);
+
+		/// <summary>
+		/// Generates the next random unsigned 64-bit integer values and stores them in the specified buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="length">The number of random integer values to generate.</param>
+		void NextUInt64s(unsigned long long* buffer, int length);
+
+		/// <summary>
+		/// Generates the specified number of random unsigned 64-bit integer values.
+		/// </summary>
+		/// <param name="count">The number of random integer values to generate.</param>
+		/// <returns>An enumerable collection of random integer values.</returns>
+		System::Collections::Generic::IEnumerable<unsigned long long>^ NextUInt64s(int count);
+
+		/// <summary>
+		/// Generates the next random value of the standard normal distribution, with mean zero and standard deviation one.
+		/// </summary>
+		/// <returns>A random normally distributed value.</returns>
+		float NextGaussian();
+
+		/// <summary>
+		/// Generates the next random value of a normal distribution with the ziggurat method.
+		/// </summary>
+		/// <param name="mean">The mean of the distribution.</param>
+		/// <param name="standardDeviation">The standard deviation of the distribution.</param>
+		/// <returns>A random normally distributed value.</returns>
+		float NextGaussian(float mean, float standardDeviation);
+
+		/// <summary>
+		/// Generates random values of a normal distribution and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random values.</param>
+		/// <param name="mean">The mean of the distribution.</param>
+		/// <param name="standardDeviation">The standard deviation of the distribution.</param>
+		void NextGaussians(array<float>^% buffer, float mean, float standardDeviation);
+
+		/// <summary>
+		/// Generates random values of a normal distribution and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="mean">The mean of the distribution.</param>
+		/// <param name="standardDeviation">The standard deviation of the distribution.</param>
+		void NextGaussians(float* buffer, int length, float mean, float standardDeviation);
+
+		/// <summary>
+		/// Generates the specified number of random values of a normal distribution.
+		/// </summary>
+		/// <param name="count">The number of values to generate.</param>
+		/// <param name="mean">The mean of the distribution.</param>
+		/// <param name="standardDeviation">The standard deviation of the distribution.</param>
+		/// <returns>An enumerable collection of random normally distributed values.</returns>
+		System::Collections::Generic::IEnumerable<float>^ NextGaussians(int count, float mean, float standardDeviation);
+
+		/// <summary>
+		/// Generates the next random value of an exponential distribution with the ziggurat method.
+		/// </summary>
+		/// <param name="lambda">The rate of the distribution, the inverse of its mean.</param>
+		/// <returns>A random exponentially distributed value.</returns>
+		float NextExponential(float lambda);
+
+		/// <summary>
+		/// Generates random values of an exponential distribution and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random values.</param>
+		/// <param name="lambda">The rate of the distribution, the inverse of its mean.</param>
+		void NextExponentials(array<float>^% buffer, float lambda);
+
+		/// <summary>
+		/// Generates random values of an exponential distribution and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="lambda">The rate of the distribution, the inverse of its mean.</param>
+		void NextExponentials(float* buffer, int length, float lambda);
+
+		/// <summary>
+		/// Generates the specified number of random values of an exponential distribution.
+		/// </summary>
+		/// <param name="count">The number of values to generate.</param>
+		/// <param name="lambda">The rate of the distribution, the inverse of its mean.</param>
+		/// <returns>An enumerable collection of random exponentially distributed values.</returns>
+		System::Collections::Generic::IEnumerable<float>^ NextExponentials(int count, float lambda);
+
+		/// <summary>
+		/// Generates the next random value of a Poisson distribution.
+		/// Means below ten use inversion, larger means use transformed rejection (PTRS).
+		/// </summary>
+		/// <param name="mean">The mean of the distribution, at most one billion.</param>
+		/// <returns>A random number of events.</returns>
+		int NextPoisson(float mean);
+
+		/// <summary>
+		/// Generates random values of a Poisson distribution and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random values.</param>
+		/// <param name="mean">The mean of the distribution, at most one billion.</param>
+		void NextPoissons(array<int>^% buffer, float mean);
+
+		/// <summary>
+		/// Generates random values of a Poisson distribution and stores them in the buffer.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="mean">The mean of the distribution, at most one billion.</param>
+		void NextPoissons(int* buffer, int length, float mean);
+
+		/// <summary>
+		/// Generates the specified number of random values of a Poisson distribution.
+		/// </summary>
+		/// <param name="count">The number of values to generate.</param>
+		/// <param name="mean">The mean of the distribution, at most one billion.</param>
+		/// <returns>An enumerable collection of random numbers of events.</returns>
+		System::Collections::Generic::IEnumerable<int>^ NextPoissons(int count, float mean);
+
+		/// <summary>
+		/// Generates random float values on multiple threads and stores them in the buffer.
+		/// The buffer is split into fixed chunks, each filled from its own stream derived from a digest of the next 55 samples of the chaos engine and the number of parallel fills since it was seeded or its state was loaded.
+		/// The values are the same on any number of processors, but differ from the values NextFloats generates.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random float values.</param>
+		void NextFloatsParallel(array<float>^% buffer);
+
+		/// <summary>
+		/// Generates random float values on multiple threads and stores them in the buffer.
+		/// The buffer is split into fixed chunks, each filled from its own stream derived from a digest of the next 55 samples of the chaos engine and the number of parallel fills since it was seeded or its state was loaded.
+		/// The values are the same on any number of processors, but differ from the values NextFloats generates.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random float values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		void NextFloatsParallel(float* buffer, int length);
+
+		/// <summary>
+		/// Generates random float values within the range [minValue, maxValue] on multiple threads and stores them in the buffer.
+		/// The buffer is split into fixed chunks, each filled from its own stream derived from a digest of the next 55 samples of the chaos engine and the number of parallel fills since it was seeded or its state was loaded.
+		/// The values are the same on any number of processors, but differ from the values NextFloats generates.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random float values.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The maximum value of the range.</param>
+		void NextFloatsParallel(array<float>^% buffer, float minValue, float maxValue);
+
+		/// <summary>
+		/// Generates random float values within the range [minValue, maxValue] on multiple threads and stores them in the buffer.
+		/// The buffer is split into fixed chunks, each filled from its own stream derived from a digest of the next 55 samples of the chaos engine and the number of parallel fills since it was seeded or its state was loaded.
+		/// The values are the same on any number of processors, but differ from the values NextFloats generates.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random float values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The maximum value of the range.</param>
+		void NextFloatsParallel(float* buffer, int length, float minValue, float maxValue);
+
 		/// <summary>
 		/// Shuffles the elements in the specified list.
 		/// </summary>
@@ -446,6 +1179,34 @@ namespace Aurora
 		generic <typename T>
 		System::Collections::Generic::IEnumerable<T>^ Choose(int count, System::Collections::Generic::IEnumerable<IWeightedObject<T>^>^ collection);
 
+		/// <summary>
+		/// Chooses a random value from the specified weighted sampler.
+		/// </summary>
+		/// <typeparam name="T">The type of values in the sampler.</typeparam>
+		/// <param name="sampler">The weighted sampler to choose from.</param>
+		/// <returns>A randomly chosen value from the weighted sampler.</returns>
+		generic <typename T>
+		T Choose(WeightedSampler<T>^ sampler);
+
+		/// <summary>
+		/// Chooses random values from the specified weighted sampler and stores them in the buffer.
+		/// </summary>
+		/// <typeparam name="T">The type of values in the sampler.</typeparam>
+		/// <param name="buffer">The buffer to store the randomly chosen values.</param>
+		/// <param name="sampler">The weighted sampler to choose from.</param>
+		generic <typename T>
+		void Choose(array<T>^% buffer, WeightedSampler<T>^ sampler);
+
+		/// <summary>
+		/// Chooses a specified number of random values from the specified weighted sampler.
+		/// </summary>
+		/// <typeparam name="T">The type of values in the sampler.</typeparam>
+		/// <param name="count">The number of values to choose.</param>
+		/// <param name="sampler">The weighted sampler to choose from.</param>
+		/// <returns>An enumerable collection of randomly chosen values from the weighted sampler.</returns>
+		generic <typename T>
+		System::Collections::Generic::IEnumerable<T>^ Choose(int count, WeightedSampler<T>^ sampler);
+
 		/// <summary>
 		/// Generates the next random enum value of the specified type.
 		/// If a value in the enum has the 'Weighted' attribute that weight will be used when selecting a value.
@@ -478,18 +1239,56 @@ namespace Aurora
 		generic <typename T> where T : System::Enum
 			System::Collections::Generic::IEnumerable<T>^ NextEnum(int count);
 
+	internal:
+		/// <summary>
+		/// Parses the seed value and retrieves the stored value.
+		/// </summary>
+		/// <param name="seed">The seed value.</param>
+		/// <param name="storedValue">The stored value extracted from the seed.</param>
+		/// <returns>The parsed seed value.</returns>
+		static int ParseSeed(System::String^ seed, [System::Runtime::InteropServices::Out] System::String^% storedValue);
+
+		/// <summary>
+		/// Derives the seed of an independent stream from a root seed.
+		/// </summary>
+		/// <param name="seed">The root seed value.</param>
+		/// <param name="stream">The index of the stream.</param>
+		/// <returns>The derived seed value.</returns>
+		static int DeriveSeed(int seed, int stream);
+
 	private:
 		/// <summary>
-		/// The internal seed value.
-		/// There is nothing 'default' about it, this value is one of the 'variables' that separates the ChaosEngine from other Instantiable Randomness Generators, that use the same algorithm
+		/// Initializes a new child instance of the ChaosEngine class from the state of its parent, without seeding it.
 		/// </summary>
-		static const int SEED = 0xBADDAD;
+		/// <param name="options">The options of the chaos engine.</param>
+		/// <param name="parentSeed">The seed of the parent as an integer.</param>
+		/// <param name="samples">The 55 samples of the parent's state, oldest first.</param>
+		/// <param name="digest">The digest of the samples.</param>
+		/// <param name="stream">The index of the child, starting at one.</param>
+		ChaosEngine(ChaosOptions options, int parentSeed, const int* samples, unsigned long long digest, int stream);
+
+		/// <summary>
+		/// Copies and digests the state for forking and re-keys this chaos engine from it.
+		/// </summary>
+		/// <param name="samples">The buffer of 55 entries to store the state, oldest first.</param>
+		/// <returns>The digest the children are keyed by.</returns>
+		unsigned long long ForkParent(int* samples);
 
 		/// <summary>
 		/// The seed used by the chaos engine.
 		/// </summary>
 		System::String^ _seed;
 
+		/// <summary>
+		/// The seed used by the chaos engine as an integer.
+		/// </summary>
+		int _seedValue;
+
+		/// <summary>
+		/// The options the chaos engine was created with.
+		/// </summary>
+		ChaosOptions _options;
+
 		/// <summary>
 		/// The index of the next random number.
 		/// </summary>
@@ -501,14 +1300,14 @@ namespace Aurora
 		int _iNextP;
 
 		/// <summary>
-		/// The array to store the seed values.
+		/// The array to store the seed values, which is also locked during concurrent access so no separate lock object is allocated.
 		/// </summary>
 		array<int>^ _seedArray = gcnew array<int>(55);
 
 		/// <summary>
-		/// Object used for locking the state during concurrent access.
+		/// The number of parallel fills since the chaos engine was seeded, which is saved with its state.
 		/// </summary>
-		System::Object^ _stateLock = gcnew System::Object();
+		unsigned int _parallelFills;
 
 		/// <summary>
 		/// The shared instance of the chaos engine.
@@ -516,12 +1315,27 @@ namespace Aurora
 		static ChaosEngine^ s_Shared;
 
 		/// <summary>
-		/// Parses the seed value and retrieves the stored value.
+		/// The chaos engine owned by the current thread.
 		/// </summary>
-		/// <param name="seed">The seed value.</param>
-		/// <param name="storedValue">The stored value extracted from the seed.</param>
-		/// <returns>The parsed seed value.</returns>
-		static int ParseSeed(System::String^ seed, [System::Runtime::InteropServices::Out] System::String^% storedValue);
+		[System::ThreadStatic]
+		static ChaosEngine^ s_ThreadLocal;
+
+		/// <summary>
+		/// Determines whether the chaos engine was created with the specified option.
+		/// </summary>
+		/// <param name="option">The option to test.</param>
+		/// <returns>true if the option is set; otherwise, false.</returns>
+		bool HasOption(ChaosOptions option);
+
+		/// <summary>
+		/// Acquires the state lock if the chaos engine is synchronized.
+		/// </summary>
+		void LockState();
+
+		/// <summary>
+		/// Releases the state lock if the chaos engine is synchronized.
+		/// </summary>
+		void UnlockState();
 
 		/// <summary>
 		/// Reseeds the chaos engine with the specified seed as an integer and stored value.
@@ -536,6 +1350,122 @@ namespace Aurora
 		/// <returns>A random sample.</returns>
 		int NextSample();
 
+		/// <summary>
+		/// Writes the next random samples into the buffer.
+		/// The state lock must be held by the caller.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random samples.</param>
+		/// <param name="count">The number of random samples to generate.</param>
+		void NextSamples(int* buffer, int count);
+
+		/// <summary>
+		/// Generates the root seed of a parallel fill from a digest of the next 55 samples and the number of parallel fills so far.
+		/// The samples of a subtractive state can repeat after a short cycle, so the count keeps consecutive fills from sharing a root.
+		/// </summary>
+		/// <returns>The root seed of the parallel fill.</returns>
+		int NextParallelSeed();
+
+		/// <summary>
+		/// Converts the next random samples into values and stores them in the buffer, taking the state lock once.
+		/// </summary>
+		/// <typeparam name="T">The type of the values.</typeparam>
+		/// <typeparam name="TConverter">The type of the function converting a sample into a value.</typeparam>
+		/// <param name="buffer">The buffer to store the values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="converter">The function converting a sample into a value.</param>
+		template <typename T, typename TConverter>
+		void NextValues(T* buffer, int length, TConverter converter);
+
+		/// <summary>
+		/// Splits the bits of the next random samples into values and stores them in the buffer, taking the state lock once.
+		/// Every sample supplies 31 bits; the first bit of a value is its least significant bit.
+		/// </summary>
+		/// <typeparam name="T">The type of the values.</typeparam>
+		/// <param name="buffer">The buffer to store the values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="bitsPerValue">The number of bits in each value, at most 64.</param>
+		template <typename T>
+		void NextPackedValues(T* buffer, int length, int bitsPerValue);
+
+		/// <summary>
+		/// Converts the next random samples into values two samples at a time and stores them in the buffer, taking the state lock once.
+		/// </summary>
+		/// <typeparam name="T">The type of the values.</typeparam>
+		/// <typeparam name="TConverter">The type of the function converting two samples into a value.</typeparam>
+		/// <param name="buffer">The buffer to store the values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="converter">The function converting two samples into a value.</param>
+		template <typename T, typename TConverter>
+		void NextPairedValues(T* buffer, int length, TConverter converter);
+
+		/// <summary>
+		/// Draws random values from a distribution and stores them in the buffer, taking the state lock once.
+		/// </summary>
+		/// <typeparam name="T">The type of the values.</typeparam>
+		/// <typeparam name="TDistribution">The type of the native distribution.</typeparam>
+		/// <param name="buffer">The buffer to store the values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="distribution">The native distribution drawing a value from the state.</param>
+		template <typename T, typename TDistribution>
+		void NextDistributionValues(T* buffer, int length, const TDistribution& distribution);
+
+		/// <summary>
+		/// Generates random boolean values with the specified probability by drawing the gaps between the true values and stores them in the buffer, taking the state lock once.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="percent">The probability of being true, greater than zero and at most SparseProbabilityLimit.</param>
+		void NextSparseProbabilities(bool* buffer, int length, double percent);
+
+		/// <summary>
+		/// Generates the next random 64-bit value within the range [0, range), or the full 64-bit range when range is zero.
+		/// </summary>
+		/// <param name="range">The number of values in the range.</param>
+		/// <returns>A random value within the specified range.</returns>
+		unsigned long long NextWideInteger(unsigned long long range);
+
+		/// <summary>
+		/// Generates random 64-bit values within the range [minValue, minValue + range) and stores them in the buffer, taking the state lock once.
+		/// </summary>
+		/// <typeparam name="T">The type of the values.</typeparam>
+		/// <param name="buffer">The buffer to store the values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="range">The number of values in the range, or zero for the full 64-bit range.</param>
+		template <typename T>
+		void NextWideValues(T* buffer, int length, unsigned long long minValue, unsigned long long range);
+
+		/// <summary>
+		/// Generates the next random integer within the range [minValue, maxValue) with Lemire's multiply and reject method.
+		/// </summary>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		/// <returns>A random integer within the specified range.</returns>
+		int NextPreciseInteger(int minValue, int maxValue);
+
+		/// <summary>
+		/// Generates random integers within the range [minValue, maxValue) with Lemire's multiply and reject method and stores them in the buffer, taking the state lock once.
+		/// </summary>
+		/// <typeparam name="T">The type of the values.</typeparam>
+		/// <param name="buffer">The buffer to store the values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		template <typename T>
+		void NextPreciseValues(T* buffer, int length, int minValue, int maxValue);
+
+		/// <summary>
+		/// Converts random samples into values on multiple threads and stores them in the buffer.
+		/// Every chunk of the buffer is filled from its own stream seeded by NextParallelSeed and the index of the chunk.
+		/// </summary>
+		/// <typeparam name="T">The type of the values.</typeparam>
+		/// <typeparam name="TConverter">The type of the function converting a sample into a value.</typeparam>
+		/// <param name="buffer">The buffer to store the values.</param>
+		/// <param name="length">The number of values to generate.</param>
+		/// <param name="converter">The function converting a sample into a value.</param>
+		template <typename T, typename TConverter>
+		void NextValuesParallel(T* buffer, int length, TConverter converter);
+
 		/// <summary>
 		/// Generates the next random float value within the range [0, 1) or [0, 1].
 		/// </summary>
@@ -0,0 +1,387 @@
+#include "ChaosEnginePool.h"
+#include "ChaosExceptions.h"
+
+#pragma managed(push, off)
+#include "../Native/ChaosCore.h"
+#pragma managed(pop)
+
+using namespace System;
+using namespace System::Diagnostics::Contracts;
+
+namespace Aurora
+{
+	ChaosEnginePool::ChaosEnginePool(int count)
+	{
+		String^ stored;
+		int seed = ChaosEngine::ParseSeed(nullptr, stored);
+		Initialize(count, seed, stored);
+	}
+
+	ChaosEnginePool::ChaosEnginePool(int count, String^ seed)
+	{
+		String^ stored;
+		int state = ChaosEngine::ParseSeed(seed, stored);
+		Initialize(count, state, stored);
+	}
+
+	ChaosEnginePool::ChaosEnginePool(int count, int seed)
+	{
+		Initialize(count, seed, seed.ToString());
+	}
+
+	int ChaosEnginePool::Count::get()
+	{
+		return _indices->Length;
+	}
+
+	String^ ChaosEnginePool::Seed::get()
+	{
+		return _seed;
+	}
+
+	void ChaosEnginePool::Reset()
+	{
+		pin_ptr<int> states = &_states[0];
+		pin_ptr<unsigned char> indices = &_indices[0];
+		Native::ChaosPoolCore pool(states, indices, _indices->Length);
+
+		for (int i = 0; i < _indices->Length; i++)
+		{
+			pool.Reseed(i, Native::DeriveSeed(_seedValue, i));
+		}
+	}
+
+	void ChaosEnginePool::Reset(int index)
+	{
+		if (index < 0 || index >= _indices->Length)
+		{
+			ThrowIndexException("index", _indices->Length);
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> states = &_states[0];
+		pin_ptr<unsigned char> indices = &_indices[0];
+		Native::ChaosPoolCore(states, indices, _indices->Length).Reseed(index, Native::DeriveSeed(_seedValue, index));
+	}
+
+	array<unsigned char>^ ChaosEnginePool::SaveState(int index)
+	{
+		if (index < 0 || index >= _indices->Length)
+		{
+			ThrowIndexException("index", _indices->Length);
+		}
+
+		Contract::EndContractBlock();
+
+		array<unsigned char>^ state = gcnew array<unsigned char>(ChaosEngine::StateSize);
+		pin_ptr<unsigned char> buffer = &state[0];
+		pin_ptr<int> states = &_states[0];
+		pin_ptr<unsigned char> indices = &_indices[0];
+
+		Native::ChaosPoolCore(states, indices, _indices->Length).SaveState(index, buffer, Native::DeriveSeed(_seedValue, index));
+		return state;
+	}
+
+	void ChaosEnginePool::LoadState(int index, array<unsigned char>^ state)
+	{
+		if (index < 0 || index >= _indices->Length)
+		{
+			ThrowIndexException("index", _indices->Length);
+		}
+
+		if (state == nullptr || state->Length < 1)
+		{
+			ThrowBufferException("state");
+		}
+
+		if (state->Length < ChaosEngine::StateSize)
+		{
+			ThrowTooLowException("state", Convert::ToString(ChaosEngine::StateSize));
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<unsigned char> buffer = &state[0];
+		pin_ptr<int> states = &_states[0];
+		pin_ptr<unsigned char> indices = &_indices[0];
+
+		if (!Native::ChaosPoolCore(states, indices, _indices->Length).LoadState(index, buffer))
+		{
+			ThrowInvalidStateException("state");
+		}
+	}
+
+	ChaosEngine^ ChaosEnginePool::CreateEngine(int index)
+	{
+		array<unsigned char>^ state = SaveState(index);
+
+		ChaosEngine^ engine = gcnew ChaosEngine(Native::DeriveSeed(_seedValue, index));
+		engine->LoadState(state);
+		return engine;
+	}
+
+	bool ChaosEnginePool::NextBoolean(int index)
+	{
+		return NextInteger(index, 0, 2) == 1;
+	}
+
+	bool ChaosEnginePool::NextProbability(int index, float percent)
+	{
+		if (index < 0 || index >= _indices->Length)
+		{
+			ThrowIndexException("index", _indices->Length);
+		}
+
+		Contract::EndContractBlock();
+
+		return percent >= 1 || (percent > 0 && NextFloat(index) < percent);
+	}
+
+	unsigned char ChaosEnginePool::NextByte(int index)
+	{
+		return static_cast<unsigned char>(NextInteger(index, 0, 256));
+	}
+
+	int ChaosEnginePool::NextInteger(int index)
+	{
+		if (index < 0 || index >= _indices->Length)
+		{
+			ThrowIndexException("index", _indices->Length);
+		}
+
+		Contract::EndContractBlock();
+
+		return NextSample(index);
+	}
+
+	int ChaosEnginePool::NextInteger(int index, int minValue, int maxValue)
+	{
+		if (index < 0 || index >= _indices->Length)
+		{
+			ThrowIndexException("index", _indices->Length);
+		}
+
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue - 1)
+			return minValue;
+
+		return Native::SampleToInteger(NextSample(index), minValue, maxValue);
+	}
+
+	float ChaosEnginePool::NextFloat(int index)
+	{
+		if (index < 0 || index >= _indices->Length)
+		{
+			ThrowIndexException("index", _indices->Length);
+		}
+
+		Contract::EndContractBlock();
+
+		return Native::SampleToRange(NextSample(index), true);
+	}
+
+	float ChaosEnginePool::NextFloat(int index, float minValue, float maxValue)
+	{
+		if (index < 0 || index >= _indices->Length)
+		{
+			ThrowIndexException("index", _indices->Length);
+		}
+
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue)
+			return minValue;
+
+		double range = maxValue - minValue;
+		return Native::SampleToFloat(NextSample(index), minValue, range);
+	}
+
+	void ChaosEnginePool::NextIntegers(array<int>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (buffer->Length < _indices->Length)
+		{
+			ThrowTooLowException("buffer", "the number of engines");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> values = &buffer[0];
+		NextValues<int>(values, 0, _indices->Length, Native::SampleConverter());
+	}
+
+	void ChaosEnginePool::NextIntegers(array<int>^% buffer, int minValue, int maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (buffer->Length < _indices->Length)
+		{
+			ThrowTooLowException("buffer", "the number of engines");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<int> values = &buffer[0];
+		NextIntegers(values, 0, _indices->Length, minValue, maxValue);
+	}
+
+	void ChaosEnginePool::NextIntegers(int* buffer, int first, int count, int minValue, int maxValue)
+	{
+		if (buffer == nullptr || count < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (first < 0 || first >= _indices->Length)
+		{
+			ThrowIndexException("first", _indices->Length);
+		}
+
+		if (count > _indices->Length - first)
+		{
+			ThrowIndexException("count", _indices->Length - first + 1);
+		}
+
+		if (minValue >= maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", false);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue - 1)
+		{
+			Native::FillValue<int>(buffer, count, minValue);
+			return;
+		}
+
+		Native::IntegerConverter converter = { minValue, maxValue };
+		NextValues<int>(buffer, first, count, converter);
+	}
+
+	void ChaosEnginePool::NextFloats(array<float>^% buffer)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (buffer->Length < _indices->Length)
+		{
+			ThrowTooLowException("buffer", "the number of engines");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<float> values = &buffer[0];
+		NextValues<float>(values, 0, _indices->Length, Native::UnitFloatConverter());
+	}
+
+	void ChaosEnginePool::NextFloats(array<float>^% buffer, float minValue, float maxValue)
+	{
+		if (buffer == nullptr || buffer->Length < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (buffer->Length < _indices->Length)
+		{
+			ThrowTooLowException("buffer", "the number of engines");
+		}
+
+		Contract::EndContractBlock();
+
+		pin_ptr<float> values = &buffer[0];
+		NextFloats(values, 0, _indices->Length, minValue, maxValue);
+	}
+
+	void ChaosEnginePool::NextFloats(float* buffer, int first, int count, float minValue, float maxValue)
+	{
+		if (buffer == nullptr || count < 1)
+		{
+			ThrowBufferException("buffer");
+		}
+
+		if (first < 0 || first >= _indices->Length)
+		{
+			ThrowIndexException("first", _indices->Length);
+		}
+
+		if (count > _indices->Length - first)
+		{
+			ThrowIndexException("count", _indices->Length - first + 1);
+		}
+
+		if (minValue > maxValue)
+		{
+			ThrowMinMaxException("minValue", "maxValue", true);
+		}
+
+		Contract::EndContractBlock();
+
+		if (minValue == maxValue)
+		{
+			Native::FillValue<float>(buffer, count, minValue);
+			return;
+		}
+
+		Native::FloatConverter converter = { minValue, static_cast<double>(maxValue - minValue) };
+		NextValues<float>(buffer, first, count, converter);
+	}
+
+	void ChaosEnginePool::Initialize(int count, int seed, String^ stored)
+	{
+		if (count < 1)
+		{
+			ThrowTooLowExceptionOne("count");
+		}
+
+		if (count > Int32::MaxValue / Native::StateLength)
+		{
+			ThrowTooHighException("count", Convert::ToString(Int32::MaxValue / Native::StateLength));
+		}
+
+		Contract::EndContractBlock();
+
+		_seedValue = seed;
+		_seed = stored;
+		_states = gcnew array<int>(Native::StateLength * count);
+		_indices = gcnew array<unsigned char>(count);
+
+		Reset();
+	}
+
+	template <typename T, typename TConverter>
+	void ChaosEnginePool::NextValues(T* buffer, int first, int count, TConverter converter)
+	{
+		pin_ptr<int> states = &_states[0];
+		pin_ptr<unsigned char> indices = &_indices[0];
+		Native::ChaosPoolCore(states, indices, _indices->Length).NextValues<T>(first, count, buffer, converter);
+	}
+
+	int ChaosEnginePool::NextSample(int index)
+	{
+		pin_ptr<int> states = &_states[0];
+		pin_ptr<unsigned char> indices = &_indices[0];
+		return Native::ChaosPoolCore(states, indices, _indices->Length).NextSample(index);
+	}
+}
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "ChaosEngine.h"
+
+namespace Aurora
+{
+	/// <summary>
+	/// Represents a fixed number of chaos engines whose states are stored together in two arrays.
+	/// A pool of any size costs the garbage collector two objects, while every ChaosEngine costs two, the engine and its seed array, and the states of neighbouring engines share cache lines.
+	/// Engine i of a pool produces the same values as a ChaosEngine seeded with the seed of the pool derived for stream i.
+	/// The pool does not lock its state; different engines can be used from different threads at the same time, but one engine must only be used by one thread at a time.
+	/// </summary>
+	[System::Serializable]
+	public ref class ChaosEnginePool sealed
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the ChaosEnginePool class with the specified number of engines and a random seed.
+		/// </summary>
+		/// <param name="count">The number of engines.</param>
+		ChaosEnginePool(int count);
+
+		/// <summary>
+		/// Initializes a new instance of the ChaosEnginePool class with the specified number of engines and seed as a string.
+		/// </summary>
+		/// <param name="count">The number of engines.</param>
+		/// <param name="seed">The seed value as a string.</param>
+		ChaosEnginePool(int count, System::String^ seed);
+
+		/// <summary>
+		/// Initializes a new instance of the ChaosEnginePool class with the specified number of engines and seed as an integer.
+		/// </summary>
+		/// <param name="count">The number of engines.</param>
+		/// <param name="seed">The seed value as an integer.</param>
+		ChaosEnginePool(int count, int seed);
+
+		/// <summary>
+		/// Gets the number of engines in the pool.
+		/// </summary>
+		property int Count { int get(); }
+
+		/// <summary>
+		/// Gets the seed used by the pool.
+		/// </summary>
+		property System::String^ Seed { System::String^ get(); }
+
+		/// <summary>
+		/// Resets every engine of the pool to its initial state.
+		/// </summary>
+		void Reset();
+
+		/// <summary>
+		/// Resets an engine of the pool to its initial state.
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		void Reset(int index);
+
+		/// <summary>
+		/// Saves the state of an engine of the pool in the layout of ChaosEngine::SaveState.
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <returns>The saved state, ChaosEngine::StateSize bytes long.</returns>
+		array<unsigned char>^ SaveState(int index);
+
+		/// <summary>
+		/// Restores the state of an engine of the pool from a state saved by the pool or by a chaos engine.
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <param name="state">The saved state.</param>
+		void LoadState(int index, array<unsigned char>^ state);
+
+		/// <summary>
+		/// Creates a chaos engine in the current state of an engine of the pool.
+		/// The two continue independently of each other.
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <returns>The chaos engine.</returns>
+		ChaosEngine^ CreateEngine(int index);
+
+		/// <summary>
+		/// Generates the next random boolean value of an engine.
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <returns>A random boolean value.</returns>
+		bool NextBoolean(int index);
+
+		/// <summary>
+		/// Generates the next random boolean value of an engine with the specified probability of being true.
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <param name="percent">The probability of being true, between 0 and 1.</param>
+		/// <returns>A random boolean value.</returns>
+		bool NextProbability(int index, float percent);
+
+		/// <summary>
+		/// Generates the next random byte value of an engine.
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <returns>A random byte value.</returns>
+		unsigned char NextByte(int index);
+
+		/// <summary>
+		/// Generates the next random integer value of an engine.
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <returns>A random integer value within the range [0, 2147483647].</returns>
+		int NextInteger(int index);
+
+		/// <summary>
+		/// Generates the next random integer value of an engine within the range [minValue, maxValue).
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		/// <returns>A random integer value within the specified range.</returns>
+		int NextInteger(int index, int minValue, int maxValue);
+
+		/// <summary>
+		/// Generates the next random float value of an engine within the range [0, 1].
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <returns>A random float value.</returns>
+		float NextFloat(int index);
+
+		/// <summary>
+		/// Generates the next random float value of an engine within the range [minValue, maxValue].
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The maximum value of the range.</param>
+		/// <returns>A random float value within the specified range.</returns>
+		float NextFloat(int index, float minValue, float maxValue);
+
+		/// <summary>
+		/// Generates the next random integer value of every engine and stores them in the buffer, in engine order.
+		/// The engines are advanced together in vector sweeps, and every engine produces the value NextInteger would.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random integer values, at least Count elements long.</param>
+		void NextIntegers(array<int>^% buffer);
+
+		/// <summary>
+		/// Generates the next random integer value of every engine within the range [minValue, maxValue) and stores them in the buffer, in engine order.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random integer values, at least Count elements long.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextIntegers(array<int>^% buffer, int minValue, int maxValue);
+
+		/// <summary>
+		/// Generates the next random integer value of a range of engines within the range [minValue, maxValue) and stores them in the buffer, in engine order.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random integer values.</param>
+		/// <param name="first">The index of the first engine.</param>
+		/// <param name="count">The number of engines.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The exclusive maximum value of the range.</param>
+		void NextIntegers(int* buffer, int first, int count, int minValue, int maxValue);
+
+		/// <summary>
+		/// Generates the next random float value of every engine within the range [0, 1] and stores them in the buffer, in engine order.
+		/// The engines are advanced together in vector sweeps, and every engine produces the value NextFloat would.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random float values, at least Count elements long.</param>
+		void NextFloats(array<float>^% buffer);
+
+		/// <summary>
+		/// Generates the next random float value of every engine within the range [minValue, maxValue] and stores them in the buffer, in engine order.
+		/// </summary>
+		/// <param name="buffer">The buffer to store the random float values, at least Count elements long.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The maximum value of the range.</param>
+		void NextFloats(array<float>^% buffer, float minValue, float maxValue);
+
+		/// <summary>
+		/// Generates the next random float value of a range of engines within the range [minValue, maxValue] and stores them in the buffer, in engine order.
+		/// </summary>
+		/// <param name="buffer">A pointer to the buffer to store the random float values.</param>
+		/// <param name="first">The index of the first engine.</param>
+		/// <param name="count">The number of engines.</param>
+		/// <param name="minValue">The minimum value of the range.</param>
+		/// <param name="maxValue">The maximum value of the range.</param>
+		void NextFloats(float* buffer, int first, int count, float minValue, float maxValue);
+
+	private:
+		/// <summary>
+		/// The seed used by the pool.
+		/// </summary>
+		System::String^ _seed;
+
+		/// <summary>
+		/// The seed used by the pool as an integer.
+		/// </summary>
+		int _seedValue;
+
+		/// <summary>
+		/// The seed arrays of all engines, slot by slot.
+		/// </summary>
+		array<int>^ _states;
+
+		/// <summary>
+		/// The index of the next random number of every engine.
+		/// </summary>
+		array<unsigned char>^ _indices;
+
+		/// <summary>
+		/// Allocates the states of the engines and seeds all of them.
+		/// </summary>
+		/// <param name="count">The number of engines.</param>
+		/// <param name="seed">The seed value as an integer.</param>
+		/// <param name="stored">The stored value extracted from the seed.</param>
+		void Initialize(int count, int seed, System::String^ stored);
+
+		/// <summary>
+		/// Converts the next random sample of a range of engines into values and stores them in the buffer.
+		/// The range must have been validated by the caller.
+		/// </summary>
+		/// <typeparam name="T">The type of the values.</typeparam>
+		/// <typeparam name="TConverter">The type of the function converting a sample into a value.</typeparam>
+		/// <param name="buffer">The buffer to store the values.</param>
+		/// <param name="first">The index of the first engine.</param>
+		/// <param name="count">The number of engines.</param>
+		/// <param name="converter">The function converting a sample into a value.</param>
+		template <typename T, typename TConverter>
+		void NextValues(T* buffer, int first, int count, TConverter converter);
+
+		/// <summary>
+		/// Generates the next random sample of an engine.
+		/// </summary>
+		/// <param name="index">The index of the engine.</param>
+		/// <returns>A random sample.</returns>
+		int NextSample(int index);
+	};
+}
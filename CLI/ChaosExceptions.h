@@ -0,0 +1,74 @@
+#pragma once
+
+namespace Aurora
+{
+	/// <summary>
+	/// Throws the exception for a minimum value that is not below, or not at most, the maximum value.
+	/// </summary>
+	/// <param name="minValue">The name of the minimum value.</param>
+	/// <param name="maxValue">The name of the maximum value.</param>
+	/// <param name="inclusive">Specifies whether the maximum value is inclusive.</param>
+	void ThrowMinMaxException(System::String^ minValue, System::String^ maxValue, bool inclusive);
+
+	/// <summary>
+	/// Throws the exception for a buffer that is null or empty.
+	/// </summary>
+	/// <param name="bufferName">The name of the buffer.</param>
+	void ThrowBufferException(System::String^ bufferName);
+
+	/// <summary>
+	/// Throws the exception for a parameter that is below its lowest allowed value.
+	/// </summary>
+	/// <param name="paramName">The name of the parameter.</param>
+	/// <param name="count">The lowest allowed value, in words.</param>
+	void ThrowTooLowException(System::String^ paramName, System::String^ count);
+
+	/// <summary>
+	/// Throws the exception for a parameter that is above its highest allowed value.
+	/// </summary>
+	/// <param name="paramName">The name of the parameter.</param>
+	/// <param name="count">The highest allowed value, in words.</param>
+	void ThrowTooHighException(System::String^ paramName, System::String^ count);
+
+	/// <summary>
+	/// Throws the exception for a parameter that is less than zero.
+	/// </summary>
+	/// <param name="paramName">The name of the parameter.</param>
+	void ThrowTooLowExceptionZero(System::String^ paramName);
+
+	/// <summary>
+	/// Throws the exception for a parameter that is less than one.
+	/// </summary>
+	/// <param name="paramName">The name of the parameter.</param>
+	void ThrowTooLowExceptionOne(System::String^ paramName);
+
+	/// <summary>
+	/// Throws the exception for an index that is less than zero or not less than the number of elements.
+	/// </summary>
+	/// <param name="paramName">The name of the index.</param>
+	/// <param name="count">The number of elements.</param>
+	void ThrowIndexException(System::String^ paramName, int count);
+
+	/// <summary>
+	/// Throws the exception for a weighted collection without any element that can be chosen, or whose weights do not have a finite sum.
+	/// </summary>
+	/// <param name="paramName">The name of the collection.</param>
+	void ThrowWeightException(System::String^ paramName);
+
+	/// <summary>
+	/// Throws the exception for a division by zero.
+	/// </summary>
+	void ThrowDivideByZeroException();
+
+	/// <summary>
+	/// Throws the exception for a saved state that is corrupt or was saved by an unsupported version.
+	/// </summary>
+	/// <param name="paramName">The name of the saved state.</param>
+	void ThrowInvalidStateException(System::String^ paramName);
+
+	/// <summary>
+	/// Throws the exception for an enum without any value that can be chosen.
+	/// </summary>
+	/// <param name="enumType">The type of the enum.</param>
+	void ThrowEnumWeightException(System::Type^ enumType);
+}
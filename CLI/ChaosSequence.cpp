@@ -0,0 +1,67 @@
+#include "ChaosSequence.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace Aurora
+{
+	generic <typename T>
+	ChaosSequence<T>::ChaosSequence(Func<T>^ generator, int count)
+	{
+		_generator = generator;
+		_count = count;
+	}
+
+	generic <typename T>
+	IEnumerator<T>^ ChaosSequence<T>::GetEnumerator()
+	{
+		return gcnew ChaosSequenceEnumerator<T>(_generator, _count);
+	}
+
+	generic <typename T>
+	Collections::IEnumerator^ ChaosSequence<T>::GetObjectEnumerator()
+	{
+		return GetEnumerator();
+	}
+
+	generic <typename T>
+	ChaosSequenceEnumerator<T>::ChaosSequenceEnumerator(Func<T>^ generator, int count)
+	{
+		_generator = generator;
+		_remaining = count;
+	}
+
+	generic <typename T>
+	ChaosSequenceEnumerator<T>::~ChaosSequenceEnumerator()
+	{
+	}
+
+	generic <typename T>
+	T ChaosSequenceEnumerator<T>::Current::get()
+	{
+		return _current;
+	}
+
+	generic <typename T>
+	Object^ ChaosSequenceEnumerator<T>::CurrentObject::get()
+	{
+		return _current;
+	}
+
+	generic <typename T>
+	bool ChaosSequenceEnumerator<T>::MoveNext()
+	{
+		if (_remaining < 1)
+			return false;
+
+		_current = _generator();
+		_remaining--;
+		return true;
+	}
+
+	generic <typename T>
+	void ChaosSequenceEnumerator<T>::Reset()
+	{
+		throw gcnew NotSupportedException();
+	}
+}
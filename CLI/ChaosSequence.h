@@ -0,0 +1,101 @@
+#pragma once
+
+namespace Aurora
+{
+	/// <summary>
+	/// Represents a sequence that generates a fixed number of values while it is enumerated.
+	/// </summary>
+	/// <typeparam name="T">The type of the values.</typeparam>
+	generic <typename T>
+	private ref class ChaosSequence sealed : System::Collections::Generic::IEnumerable<T>
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the ChaosSequence class.
+		/// </summary>
+		/// <param name="generator">The function generating the next value.</param>
+		/// <param name="count">The number of values in the sequence.</param>
+		ChaosSequence(System::Func<T>^ generator, int count);
+
+		/// <summary>
+		/// Returns an enumerator that generates the values of the sequence.
+		/// </summary>
+		/// <returns>An enumerator that generates the values of the sequence.</returns>
+		virtual System::Collections::Generic::IEnumerator<T>^ GetEnumerator();
+
+	private:
+		/// <summary>
+		/// Returns an enumerator that generates the values of the sequence.
+		/// </summary>
+		/// <returns>An enumerator that generates the values of the sequence.</returns>
+		virtual System::Collections::IEnumerator^ GetObjectEnumerator() sealed = System::Collections::IEnumerable::GetEnumerator;
+
+		/// <summary>
+		/// The function generating the next value.
+		/// </summary>
+		System::Func<T>^ _generator;
+
+		/// <summary>
+		/// The number of values in the sequence.
+		/// </summary>
+		int _count;
+	};
+
+	/// <summary>
+	/// Enumerates a ChaosSequence, generating one value per step.
+	/// </summary>
+	/// <typeparam name="T">The type of the values.</typeparam>
+	generic <typename T>
+	private ref class ChaosSequenceEnumerator sealed : System::Collections::Generic::IEnumerator<T>
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the ChaosSequenceEnumerator class.
+		/// </summary>
+		/// <param name="generator">The function generating the next value.</param>
+		/// <param name="count">The number of values to generate.</param>
+		ChaosSequenceEnumerator(System::Func<T>^ generator, int count);
+
+		/// <summary>
+		/// Releases the enumerator.
+		/// </summary>
+		~ChaosSequenceEnumerator();
+
+		/// <summary>
+		/// Gets the most recently generated value.
+		/// </summary>
+		property T Current { virtual T get(); }
+
+		/// <summary>
+		/// Generates the next value.
+		/// </summary>
+		/// <returns>true if a value was generated; false if the sequence is exhausted.</returns>
+		virtual bool MoveNext();
+
+		/// <summary>
+		/// Not supported; generated values cannot be replayed.
+		/// </summary>
+		virtual void Reset();
+
+	private:
+		/// <summary>
+		/// Gets the most recently generated value.
+		/// </summary>
+		property System::Object^ CurrentObject { virtual System::Object^ get() sealed = System::Collections::IEnumerator::Current::get; }
+
+		/// <summary>
+		/// The function generating the next value.
+		/// </summary>
+		System::Func<T>^ _generator;
+
+		/// <summary>
+		/// The number of values left to generate.
+		/// </summary>
+		int _remaining;
+
+		/// <summary>
+		/// The most recently generated value.
+		/// </summary>
+		T _current;
+	};
+}
@@ -0,0 +1,166 @@
+#include "WeightedSampler.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Diagnostics::Contracts;
+
+namespace Aurora
+{
+	/// <summary>
+	/// The scale converting a sample to a value in the range [0, 1).
+	/// </summary>
+	const double CoinScale = 1.0 / 2147483648.0;
+
+	generic <typename T>
+	WeightedSampler<T>::WeightedSampler(IEnumerable<IWeightedObject<T>^>^ collection)
+	{
+		if (collection == nullptr)
+		{
+			throw gcnew ArgumentNullException("collection");
+		}
+
+		Contract::EndContractBlock();
+
+		List<T>^ values = gcnew List<T>();
+		List<double>^ weights = gcnew List<double>();
+
+		for each (IWeightedObject<T>^ t in collection)
+		{
+			double weight = static_cast<double>(t->Weight);
+
+			if (weight > 0)
+			{
+				values->Add(t->Value);
+				weights->Add(weight);
+			}
+		}
+
+		Build(values, weights);
+	}
+
+	generic <typename T>
+	WeightedSampler<T>::WeightedSampler(array<T>^ values, array<double>^ weights)
+	{
+		if (values == nullptr)
+		{
+			throw gcnew ArgumentNullException("values");
+		}
+
+		if (weights == nullptr)
+		{
+			throw gcnew ArgumentNullException("weights");
+		}
+
+		if (values->Length != weights->Length)
+		{
+			throw gcnew ArgumentException("'values' and 'weights' must contain the same number of elements.");
+		}
+
+		Contract::EndContractBlock();
+
+		List<T>^ selectable = gcnew List<T>(values->Length);
+		List<double>^ selectableWeights = gcnew List<double>(values->Length);
+
+		for (int i = 0; i < values->Length; i++)
+		{
+			if (weights[i] > 0)
+			{
+				selectable->Add(values[i]);
+				selectableWeights->Add(weights[i]);
+			}
+		}
+
+		Build(selectable, selectableWeights);
+	}
+
+	generic <typename T>
+	int WeightedSampler<T>::Count::get()
+	{
+		return _values->Length;
+	}
+
+	generic <typename T>
+	double WeightedSampler<T>::TotalWeight::get()
+	{
+		return _totalWeight;
+	}
+
+	generic <typename T>
+	T WeightedSampler<T>::Select(int columnSample, int coinSample)
+	{
+		int column = static_cast<int>((static_cast<long long>(columnSample) * _values->Length) >> 31);
+
+		if (coinSample * CoinScale < _probabilities[column])
+			return _values[column];
+
+		return _values[_aliases[column]];
+	}
+
+	generic <typename T>
+	void WeightedSampler<T>::Build(List<T>^ values, List<double>^ weights)
+	{
+		int count = values->Count;
+		double totalWeight = 0;
+
+		for (int i = 0; i < count; i++)
+		{
+			totalWeight += weights[i];
+		}
+
+		if (count < 1 || Double::IsInfinity(totalWeight))
+		{
+			throw gcnew ArgumentException("The weights must contain at least one finite weight greater than zero.");
+		}
+
+		_values = values->ToArray();
+		_probabilities = gcnew array<double>(count);
+		_aliases = gcnew array<int>(count);
+		_totalWeight = totalWeight;
+
+		array<double>^ scaled = gcnew array<double>(count);
+		array<int>^ small = gcnew array<int>(count);
+		array<int>^ large = gcnew array<int>(count);
+		int smallCount = 0;
+		int largeCount = 0;
+
+		for (int i = 0; i < count; i++)
+		{
+			scaled[i] = weights[i] * count / totalWeight;
+
+			if (scaled[i] < 1.0)
+				small[smallCount++] = i;
+			else
+				large[largeCount++] = i;
+		}
+
+		while (smallCount > 0 && largeCount > 0)
+		{
+			int less = small[--smallCount];
+			int more = large[--largeCount];
+
+			_probabilities[less] = scaled[less];
+			_aliases[less] = more;
+
+			scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+
+			if (scaled[more] < 1.0)
+				small[smallCount++] = more;
+			else
+				large[largeCount++] = more;
+		}
+
+		while (largeCount > 0)
+		{
+			int index = large[--largeCount];
+			_probabilities[index] = 1.0;
+			_aliases[index] = index;
+		}
+
+		while (smallCount > 0)
+		{
+			int index = small[--smallCount];
+			_probabilities[index] = 1.0;
+			_aliases[index] = index;
+		}
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "IWeightedObject.h"
+
+namespace Aurora
+{
+	/// <summary>
+	/// Represents a precomputed table for choosing values by weight in constant time.
+	/// The table is built once using the alias method, so its size depends only on the number of values and not on their weights.
+	/// </summary>
+	/// <typeparam name="T">The type of the values.</typeparam>
+	generic <typename T>
+	public ref class WeightedSampler sealed
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the WeightedSampler class from a weighted collection.
+		/// Elements with a weight of 0 or less can never be chosen.
+		/// </summary>
+		/// <param name="collection">The weighted collection to choose from.</param>
+		WeightedSampler(System::Collections::Generic::IEnumerable<IWeightedObject<T>^>^ collection);
+
+		/// <summary>
+		/// Initializes a new instance of the WeightedSampler class from values and their fractional weights.
+		/// Values with a weight of 0 or less can never be chosen.
+		/// </summary>
+		/// <param name="values">The values to choose from.</param>
+		/// <param name="weights">The weight of each value.</param>
+		WeightedSampler(array<T>^ values, array<double>^ weights);
+
+		/// <summary>
+		/// Gets the number of values that can be chosen.
+		/// </summary>
+		property int Count { int get(); }
+
+		/// <summary>
+		/// Gets the sum of the weights of the values that can be chosen.
+		/// </summary>
+		property double TotalWeight { double get(); }
+
+	internal:
+		/// <summary>
+		/// Chooses a value using two samples of a chaos engine.
+		/// </summary>
+		/// <param name="columnSample">The sample selecting the column of the table.</param>
+		/// <param name="coinSample">The sample selecting between the column's value and its alias.</param>
+		/// <returns>The chosen value.</returns>
+		T Select(int columnSample, int coinSample);
+
+	private:
+		/// <summary>
+		/// Builds the probability and alias tables from the collected values and weights.
+		/// </summary>
+		/// <param name="values">The values with a weight greater than zero.</param>
+		/// <param name="weights">The weight of each value.</param>
+		void Build(System::Collections::Generic::List<T>^ values, System::Collections::Generic::List<double>^ weights);
+
+		/// <summary>
+		/// The values that can be chosen.
+		/// </summary>
+		array<T>^ _values;
+
+		/// <summary>
+		/// The probability of each column choosing its own value instead of its alias.
+		/// </summary>
+		array<double>^ _probabilities;
+
+		/// <summary>
+		/// The index of the value chosen when a column does not choose its own value.
+		/// </summary>
+		array<int>^ _aliases;
+
+		/// <summary>
+		/// The sum of the weights of the values.
+		/// </summary>
+		double _totalWeight;
+	};
+}
@@ -0,0 +1,2664 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#include <concepts>
+#include <random>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define AURORA_CHAOS_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+#if defined(__cpp_lib_is_constant_evaluated)
+#define AURORA_CHAOS_CONSTEXPR20 constexpr
+#else
+#define AURORA_CHAOS_CONSTEXPR20 inline
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define AURORA_CHAOS_TARGET(features)
+#else
+#define AURORA_CHAOS_TARGET(features) __attribute__((target(features)))
+#endif
+
+namespace Aurora
+{
+	namespace Native
+	{
+		/// <summary>
+		/// The internal seed value.
+		/// There is nothing 'default' about it, this value is one of the 'variables' that separates the ChaosEngine from other Instantiable Randomness Generators, that use the same algorithm
+		/// </summary>
+		constexpr int InternalSeed = 0xBADDAD;
+
+		/// <summary>
+		/// The number of entries in the seed array.
+		/// </summary>
+		constexpr int StateLength = 55;
+
+		/// <summary>
+		/// The distance between a sample and the most recent sample it depends on.
+		/// Every run of this many consecutive samples is independent of itself.
+		/// </summary>
+		constexpr int SampleLag = 13;
+
+		/// <summary>
+		/// The position of the second index in the seed array after reseeding.
+		/// </summary>
+		constexpr int InitialNextP = 42;
+
+		/// <summary>
+		/// The number of samples converted per step of a bulk fill.
+		/// </summary>
+		constexpr int SampleChunk = 1024;
+
+		/// <summary>
+		/// Subtracts two integers with two's complement wrapping, as the managed seeding arithmetic does.
+		/// </summary>
+		constexpr int WrappingSubtract(int left, int right)
+		{
+			return static_cast<int>(static_cast<std::uint32_t>(left) - static_cast<std::uint32_t>(right));
+		}
+
+		/// <summary>
+		/// Combines the two samples a new sample depends on.
+		/// </summary>
+		constexpr int SubtractSamples(int oldest, int recent)
+		{
+			int retVal = oldest - recent;
+
+			if (retVal == std::numeric_limits<int>::max())
+			{
+				retVal--;
+			}
+
+			if (retVal < 0)
+			{
+				retVal = std::numeric_limits<int>::max();
+			}
+
+			return retVal;
+		}
+
+		/// <summary>
+		/// Fills the seed array from an integer seed and resets both indices.
+		/// </summary>
+		constexpr void ReseedState(int* seedArray, int& iNext, int& iNextP, int seed)
+		{
+			int subtraction = seed == std::numeric_limits<int>::min() ? std::numeric_limits<int>::max() : (seed < 0 ? -seed : seed);
+			int mj = InternalSeed - subtraction;
+			seedArray[54] = mj;
+			int mk = 1;
+
+			for (int i = 0; i < 54; i++)
+			{
+				int ii = (42 * (i + 1) % 55) - 1;
+				seedArray[ii] = mk;
+				mk = WrappingSubtract(mj, mk);
+
+				if (mk < 0)
+				{
+					mk += std::numeric_limits<int>::max();
+				}
+
+				mj = seedArray[ii];
+			}
+
+			for (int k = 1; k < 5; k++)
+			{
+				for (int i = 0; i < 55; i++)
+				{
+					seedArray[i] = WrappingSubtract(seedArray[i], seedArray[(i + 30) % 55]);
+
+					if (seedArray[i] < 0)
+					{
+						seedArray[i] += std::numeric_limits<int>::max();
+					}
+				}
+			}
+
+			iNext = 0;
+			iNextP = InitialNextP;
+		}
+
+		/// <summary>
+		/// Generates the next sample of the seed array and advances both indices.
+		/// </summary>
+		constexpr int NextSample(int* seedArray, int& iNext, int& iNextP)
+		{
+			int retVal = SubtractSamples(seedArray[iNext], seedArray[iNextP]);
+
+			seedArray[iNext] = retVal;
+
+			if (++iNext >= StateLength)
+			{
+				iNext = 0;
+			}
+
+			if (++iNextP >= StateLength)
+			{
+				iNextP = 0;
+			}
+
+			return retVal;
+		}
+
+		/// <summary>
+		/// Mixes the bits of a 64-bit value with the SplitMix64 finalizer.
+		/// </summary>
+		constexpr std::uint64_t MixBits(std::uint64_t z)
+		{
+			z += 0x9E3779B97F4A7C15ULL;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			return z ^ (z >> 31);
+		}
+
+		/// <summary>
+		/// Derives the seed of an independent stream from a root seed.
+		/// </summary>
+		constexpr int DeriveSeed(int seed, int stream)
+		{
+			return static_cast<int>(MixBits((static_cast<std::uint64_t>(static_cast<std::uint32_t>(seed)) << 32) | static_cast<std::uint32_t>(stream)));
+		}
+
+		/// <summary>
+		/// Hashes samples together with a stream index into a 64-bit digest that depends on every sample.
+		/// Each step is one multiply, and only the final value is fully mixed.
+		/// </summary>
+		constexpr std::uint64_t DigestSamples(const int* samples, int count, std::uint64_t stream)
+		{
+			std::uint64_t digest = stream;
+
+			for (int i = 0; i < count; i++)
+			{
+				digest = (digest ^ static_cast<std::uint32_t>(samples[i])) * 0x9E3779B97F4A7C15ULL;
+				digest ^= digest >> 32;
+			}
+
+			return MixBits(digest);
+		}
+
+		/// <summary>
+		/// Copies the seed array in the order its samples were generated, oldest first.
+		/// </summary>
+		constexpr void CopyRing(const int* seedArray, int iNext, int* samples)
+		{
+			for (int i = 0; i < StateLength; i++)
+			{
+				samples[i] = seedArray[(iNext + i) % StateLength];
+			}
+		}
+
+		/// <summary>
+		/// Builds a new seed array from 55 samples by masking every sample with a keystream keyed by the digest of all of them and a stream index.
+		/// The key depends on every sample, since about half of the samples of a subtractive state are the clamped maximum, so one multiply per entry is enough for the mask.
+		/// Different stream indices give unrelated seed arrays from the same samples.
+		/// The indices are reset as for a freshly seeded state.
+		/// </summary>
+		/// <param name="samples">The 55 samples.</param>
+		/// <param name="digest">The digest of the samples from DigestSamples.</param>
+		/// <param name="stream">The index of the stream.</param>
+		constexpr void ForkState(const int* samples, std::uint64_t digest, int stream, int* seedArray, int& iNext, int& iNextP)
+		{
+			std::uint64_t key = MixBits(digest + static_cast<std::uint32_t>(stream));
+
+			for (int i = 0; i < StateLength; i++)
+			{
+				std::uint64_t z = key + (i + 1) * 0x9E3779B97F4A7C15ULL;
+				z = (z ^ (z >> 31)) * 0xBF58476D1CE4E5B9ULL;
+				seedArray[i] = static_cast<int>((static_cast<std::uint32_t>(samples[i]) ^ static_cast<std::uint32_t>(z >> 32)) & 0x7FFFFFFFu);
+			}
+
+			iNext = 0;
+			iNextP = InitialNextP;
+		}
+
+		/// <summary>
+		/// Extends a contiguous sample sequence whose previous 55 samples are stored directly before it.
+		/// </summary>
+		inline void AdvanceSequence(int* sequence, int count)
+		{
+			for (int offset = 0; offset < count; offset += SampleLag)
+			{
+				int block = count - offset < SampleLag ? count - offset : SampleLag;
+				int* output = sequence + offset;
+				const int* oldest = output - StateLength;
+				const int* recent = output - SampleLag;
+
+				for (int i = 0; i < block; i++)
+				{
+					output[i] = SubtractSamples(oldest[i], recent[i]);
+				}
+			}
+		}
+
+#if defined(AURORA_CHAOS_X86)
+		/// <summary>
+		/// Extends a sample sequence four samples at a time.
+		/// </summary>
+		AURORA_CHAOS_TARGET("sse2")
+		inline void AdvanceSequenceSse2(int* sequence, int count)
+		{
+			const __m128i max = _mm_set1_epi32(std::numeric_limits<int>::max());
+			int offset = 0;
+
+			for (; offset + 4 <= count; offset += 4)
+			{
+				int* output = sequence + offset;
+				__m128i oldest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(output - StateLength));
+				__m128i recent = _mm_loadu_si128(reinterpret_cast<const __m128i*>(output - SampleLag));
+
+				__m128i retVal = _mm_sub_epi32(oldest, recent);
+				retVal = _mm_add_epi32(retVal, _mm_cmpeq_epi32(retVal, max));
+
+				__m128i negative = _mm_srai_epi32(retVal, 31);
+				retVal = _mm_or_si128(_mm_andnot_si128(negative, retVal), _mm_srli_epi32(negative, 1));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output), retVal);
+			}
+
+			AdvanceSequence(sequence + offset, count - offset);
+		}
+
+		/// <summary>
+		/// Extends a sample sequence eight samples at a time.
+		/// </summary>
+		AURORA_CHAOS_TARGET("avx2")
+		inline void AdvanceSequenceAvx2(int* sequence, int count)
+		{
+			const __m256i max = _mm256_set1_epi32(std::numeric_limits<int>::max());
+			int offset = 0;
+
+			for (; offset + 8 <= count; offset += 8)
+			{
+				int* output = sequence + offset;
+				__m256i oldest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(output - StateLength));
+				__m256i recent = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(output - SampleLag));
+
+				__m256i retVal = _mm256_sub_epi32(oldest, recent);
+				retVal = _mm256_add_epi32(retVal, _mm256_cmpeq_epi32(retVal, max));
+
+				__m256i negative = _mm256_srai_epi32(retVal, 31);
+				retVal = _mm256_or_si256(_mm256_andnot_si256(negative, retVal), _mm256_srli_epi32(negative, 1));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(output), retVal);
+			}
+
+			AdvanceSequence(sequence + offset, count - offset);
+		}
+
+		/// <summary>
+		/// Extends a sample sequence a full block of 13 samples at a time using masked 16 lane vectors.
+		/// Wider vectors would read samples that have not been generated yet.
+		/// </summary>
+		AURORA_CHAOS_TARGET("avx512f")
+		inline void AdvanceSequenceAvx512(int* sequence, int count)
+		{
+			const __m512i max = _mm512_set1_epi32(std::numeric_limits<int>::max());
+			const __m512i one = _mm512_set1_epi32(1);
+			const __mmask16 lanes = static_cast<__mmask16>((1 << SampleLag) - 1);
+			int offset = 0;
+
+			for (; offset + SampleLag <= count; offset += SampleLag)
+			{
+				int* output = sequence + offset;
+				__m512i oldest = _mm512_maskz_loadu_epi32(lanes, output - StateLength);
+				__m512i recent = _mm512_maskz_loadu_epi32(lanes, output - SampleLag);
+
+				__m512i retVal = _mm512_sub_epi32(oldest, recent);
+				retVal = _mm512_mask_sub_epi32(retVal, _mm512_cmpeq_epi32_mask(retVal, max), retVal, one);
+				retVal = _mm512_mask_mov_epi32(retVal, _mm512_cmplt_epi32_mask(retVal, _mm512_setzero_si512()), max);
+
+				_mm512_mask_storeu_epi32(output, lanes, retVal);
+			}
+
+			AdvanceSequence(sequence + offset, count - offset);
+		}
+#endif
+
+		/// <summary>
+		/// Specifies the widest vector instructions the kernels can use.
+		/// </summary>
+		enum class KernelLevel
+		{
+			Scalar,
+			Sse2,
+			Avx2,
+			Avx512,
+		};
+
+		/// <summary>
+		/// Detects the widest vector instructions supported by the processor and the operating system.
+		/// </summary>
+		inline KernelLevel DetectKernelLevel()
+		{
+#if defined(AURORA_CHAOS_X86) && defined(_MSC_VER)
+			int info[4];
+
+			__cpuid(info, 0);
+			int maxLeaf = info[0];
+
+			__cpuid(info, 1);
+			bool sse2 = (info[3] & (1 << 26)) != 0;
+			bool osxsave = (info[2] & (1 << 27)) != 0;
+
+			bool avx2 = false;
+			bool avx512 = false;
+
+			if (osxsave && maxLeaf >= 7)
+			{
+				unsigned long long xcr0 = _xgetbv(0);
+
+				__cpuidex(info, 7, 0);
+				avx2 = (info[1] & (1 << 5)) != 0 && (xcr0 & 0x06) == 0x06;
+				avx512 = (info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+			}
+
+			if (avx512)
+				return KernelLevel::Avx512;
+
+			if (avx2)
+				return KernelLevel::Avx2;
+
+			if (sse2)
+				return KernelLevel::Sse2;
+#elif defined(AURORA_CHAOS_X86)
+			__builtin_cpu_init();
+
+			if (__builtin_cpu_supports("avx512f"))
+				return KernelLevel::Avx512;
+
+			if (__builtin_cpu_supports("avx2"))
+				return KernelLevel::Avx2;
+
+			if (__builtin_cpu_supports("sse2"))
+				return KernelLevel::Sse2;
+#endif
+
+			return KernelLevel::Scalar;
+		}
+
+		typedef void (*SequenceKernel)(int* sequence, int count);
+
+		/// <summary>
+		/// Selects the widest sequence kernel supported by the processor and the operating system.
+		/// </summary>
+		inline SequenceKernel SelectSequenceKernel()
+		{
+#if defined(AURORA_CHAOS_X86)
+			switch (DetectKernelLevel())
+			{
+			case KernelLevel::Avx512:
+				return AdvanceSequenceAvx512;
+			case KernelLevel::Avx2:
+				return AdvanceSequenceAvx2;
+			case KernelLevel::Sse2:
+				return AdvanceSequenceSse2;
+			default:
+				break;
+			}
+#endif
+
+			return AdvanceSequence;
+		}
+
+		/// <summary>
+		/// Extends a sample sequence with the kernel selected for the current processor.
+		/// </summary>
+		inline void AdvanceSequenceFast(int* sequence, int count)
+		{
+			static const SequenceKernel kernel = SelectSequenceKernel();
+			kernel(sequence, count);
+		}
+
+		/// <summary>
+		/// Generates one sample for each of a row of independent states whose oldest and recent slots are stored in two rows.
+		/// The samples replace the oldest slots and are also stored in the buffer.
+		/// </summary>
+		inline void SubtractRows(int* oldest, const int* recent, int* buffer, int count)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				int retVal = SubtractSamples(oldest[i], recent[i]);
+				oldest[i] = retVal;
+				buffer[i] = retVal;
+			}
+		}
+
+#if defined(AURORA_CHAOS_X86)
+		/// <summary>
+		/// Generates samples for a row of states four states at a time.
+		/// </summary>
+		AURORA_CHAOS_TARGET("sse2")
+		inline void SubtractRowsSse2(int* oldest, const int* recent, int* buffer, int count)
+		{
+			const __m128i max = _mm_set1_epi32(std::numeric_limits<int>::max());
+			int offset = 0;
+
+			for (; offset + 4 <= count; offset += 4)
+			{
+				__m128i retVal = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(oldest + offset)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(recent + offset)));
+				retVal = _mm_add_epi32(retVal, _mm_cmpeq_epi32(retVal, max));
+
+				__m128i negative = _mm_srai_epi32(retVal, 31);
+				retVal = _mm_or_si128(_mm_andnot_si128(negative, retVal), _mm_srli_epi32(negative, 1));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(oldest + offset), retVal);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(buffer + offset), retVal);
+			}
+
+			SubtractRows(oldest + offset, recent + offset, buffer + offset, count - offset);
+		}
+
+		/// <summary>
+		/// Generates samples for a row of states eight states at a time.
+		/// </summary>
+		AURORA_CHAOS_TARGET("avx2")
+		inline void SubtractRowsAvx2(int* oldest, const int* recent, int* buffer, int count)
+		{
+			const __m256i max = _mm256_set1_epi32(std::numeric_limits<int>::max());
+			int offset = 0;
+
+			for (; offset + 8 <= count; offset += 8)
+			{
+				__m256i retVal = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(oldest + offset)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(recent + offset)));
+				retVal = _mm256_add_epi32(retVal, _mm256_cmpeq_epi32(retVal, max));
+
+				__m256i negative = _mm256_srai_epi32(retVal, 31);
+				retVal = _mm256_or_si256(_mm256_andnot_si256(negative, retVal), _mm256_srli_epi32(negative, 1));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(oldest + offset), retVal);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(buffer + offset), retVal);
+			}
+
+			SubtractRows(oldest + offset, recent + offset, buffer + offset, count - offset);
+		}
+
+		/// <summary>
+		/// Generates samples for a row of states sixteen states at a time.
+		/// Unlike a single sequence, the states do not depend on each other, so every lane can be used.
+		/// </summary>
+		AURORA_CHAOS_TARGET("avx512f")
+		inline void SubtractRowsAvx512(int* oldest, const int* recent, int* buffer, int count)
+		{
+			const __m512i max = _mm512_set1_epi32(std::numeric_limits<int>::max());
+			const __m512i one = _mm512_set1_epi32(1);
+			int offset = 0;
+
+			for (; offset + 16 <= count; offset += 16)
+			{
+				__m512i retVal = _mm512_sub_epi32(_mm512_loadu_si512(oldest + offset), _mm512_loadu_si512(recent + offset));
+				retVal = _mm512_mask_sub_epi32(retVal, _mm512_cmpeq_epi32_mask(retVal, max), retVal, one);
+				retVal = _mm512_mask_mov_epi32(retVal, _mm512_cmplt_epi32_mask(retVal, _mm512_setzero_si512()), max);
+
+				_mm512_storeu_si512(oldest + offset, retVal);
+				_mm512_storeu_si512(buffer + offset, retVal);
+			}
+
+			SubtractRows(oldest + offset, recent + offset, buffer + offset, count - offset);
+		}
+#endif
+
+		typedef void (*RowKernel)(int* oldest, const int* recent, int* buffer, int count);
+
+		/// <summary>
+		/// Selects the widest row kernel supported by the processor and the operating system.
+		/// </summary>
+		inline RowKernel SelectRowKernel()
+		{
+#if defined(AURORA_CHAOS_X86)
+			switch (DetectKernelLevel())
+			{
+			case KernelLevel::Avx512:
+				return SubtractRowsAvx512;
+			case KernelLevel::Avx2:
+				return SubtractRowsAvx2;
+			case KernelLevel::Sse2:
+				return SubtractRowsSse2;
+			default:
+				break;
+			}
+#endif
+
+			return SubtractRows;
+		}
+
+		/// <summary>
+		/// Generates samples for a row of states with the kernel selected for the current processor.
+		/// </summary>
+		inline void SubtractRowsFast(int* oldest, const int* recent, int* buffer, int count)
+		{
+			static const RowKernel kernel = SelectRowKernel();
+			kernel(oldest, recent, buffer, count);
+		}
+
+		/// <summary>
+		/// Writes the next samples of the seed array into the buffer and advances the state past them.
+		/// Produces exactly the samples that calling NextSample count times would.
+		/// During constant evaluation the samples are generated one at a time, since the vector kernels cannot run there.
+		/// </summary>
+		AURORA_CHAOS_CONSTEXPR20 void GenerateSamples(int* seedArray, int& iNext, int& iNextP, int* buffer, int count)
+		{
+#if defined(__cpp_lib_is_constant_evaluated)
+			if (std::is_constant_evaluated())
+			{
+				for (int i = 0; i < count; i++)
+				{
+					buffer[i] = NextSample(seedArray, iNext, iNextP);
+				}
+
+				return;
+			}
+#endif
+
+			int window[StateLength * 2];
+
+			for (int i = 0; i < StateLength; i++)
+			{
+				window[i] = seedArray[(iNext + i) % StateLength];
+			}
+
+			int head = count < StateLength ? count : StateLength;
+			AdvanceSequenceFast(window + StateLength, head);
+			std::memcpy(buffer, window + StateLength, head * sizeof(int));
+
+			if (count > StateLength)
+			{
+				AdvanceSequenceFast(buffer + StateLength, count - StateLength);
+			}
+
+			const int* last = count < StateLength ? window + count : buffer + count - StateLength;
+			int step = count % StateLength;
+
+			iNext = (iNext + step) % StateLength;
+			iNextP = (iNextP + step) % StateLength;
+
+			for (int i = 0; i < StateLength; i++)
+			{
+				seedArray[(iNext + i) % StateLength] = last[i];
+			}
+		}
+
+		/// <summary>
+		/// Advances the state past the next samples of the seed array without storing them.
+		/// The clamp applied to every sample makes the recurrence nonlinear, so there is no shortcut that skips samples without computing them.
+		/// Instead the samples are computed in large blocks with the vector kernels, leaving the state exactly as calling NextSample count times would.
+		/// </summary>
+		AURORA_CHAOS_CONSTEXPR20 void DiscardSamples(int* seedArray, int& iNext, int& iNextP, unsigned long long count)
+		{
+#if defined(__cpp_lib_is_constant_evaluated)
+			if (std::is_constant_evaluated())
+			{
+				for (unsigned long long i = 0; i < count; i++)
+				{
+					NextSample(seedArray, iNext, iNextP);
+				}
+
+				return;
+			}
+#endif
+
+			if (count >= StateLength)
+			{
+				int window[StateLength + SampleChunk];
+
+				for (int i = 0; i < StateLength; i++)
+				{
+					window[i] = seedArray[(iNext + i) % StateLength];
+				}
+
+				while (count >= StateLength)
+				{
+					int block = count < SampleChunk ? static_cast<int>(count) : SampleChunk;
+
+					AdvanceSequenceFast(window + StateLength, block);
+					std::memmove(window, window + block, StateLength * sizeof(int));
+					count -= block;
+
+					int step = block % StateLength;
+					iNext = (iNext + step) % StateLength;
+					iNextP = (iNextP + step) % StateLength;
+				}
+
+				for (int i = 0; i < StateLength; i++)
+				{
+					seedArray[(iNext + i) % StateLength] = window[i];
+				}
+			}
+
+			if (count > 0)
+			{
+				int samples[StateLength];
+				GenerateSamples(seedArray, iNext, iNextP, samples, static_cast<int>(count));
+			}
+		}
+
+		/// <summary>
+		/// The number of bytes in a saved state.
+		/// </summary>
+		constexpr int SavedStateSize = 236;
+
+		/// <summary>
+		/// The first four bytes of a saved state, "CHOS" in ASCII.
+		/// </summary>
+		constexpr std::uint32_t SavedStateMagic = 0x534F4843u;
+
+		/// <summary>
+		/// The version of the saved state layout.
+		/// </summary>
+		constexpr int SavedStateVersion = 2;
+
+		/// <summary>
+		/// Writes a 32-bit value to a saved state in little endian order.
+		/// </summary>
+		constexpr void WriteStateValue(unsigned char* buffer, std::uint32_t value)
+		{
+			buffer[0] = static_cast<unsigned char>(value);
+			buffer[1] = static_cast<unsigned char>(value >> 8);
+			buffer[2] = static_cast<unsigned char>(value >> 16);
+			buffer[3] = static_cast<unsigned char>(value >> 24);
+		}
+
+		/// <summary>
+		/// Reads a 32-bit value from a saved state in little endian order.
+		/// </summary>
+		constexpr std::uint32_t ReadStateValue(const unsigned char* buffer)
+		{
+			return static_cast<std::uint32_t>(buffer[0]) | (static_cast<std::uint32_t>(buffer[1]) << 8) | (static_cast<std::uint32_t>(buffer[2]) << 16) | (static_cast<std::uint32_t>(buffer[3]) << 24);
+		}
+
+		/// <summary>
+		/// Writes the state to a buffer of SavedStateSize bytes.
+		/// The layout is the magic value, a 16-bit version, the 16-bit index of the next sample, the integer seed, the 55 entries of the seed array and the number of parallel fills, all little endian.
+		/// The second index is not stored, since it is always 42 entries after the first.
+		/// </summary>
+		constexpr void SaveState(unsigned char* buffer, const int* seedArray, int iNext, int seed, std::uint32_t parallelFills)
+		{
+			WriteStateValue(buffer, SavedStateMagic);
+			WriteStateValue(buffer + 4, static_cast<std::uint32_t>(SavedStateVersion) | (static_cast<std::uint32_t>(iNext) << 16));
+			WriteStateValue(buffer + 8, static_cast<std::uint32_t>(seed));
+
+			for (int i = 0; i < StateLength; i++)
+			{
+				WriteStateValue(buffer + 12 + i * 4, static_cast<std::uint32_t>(seedArray[i]));
+			}
+
+			WriteStateValue(buffer + 12 + StateLength * 4, parallelFills);
+		}
+
+		/// <summary>
+		/// Reads a state written by SaveState.
+		/// The state is only changed when the buffer holds a valid state of a supported version.
+		/// </summary>
+		/// <returns>true if the state was read; otherwise, false.</returns>
+		constexpr bool LoadState(const unsigned char* buffer, int* seedArray, int& iNext, int& iNextP, int& seed, std::uint32_t& parallelFills)
+		{
+			std::uint32_t header = ReadStateValue(buffer + 4);
+			int version = static_cast<int>(header & 0xFFFF);
+			int next = static_cast<int>(header >> 16);
+
+			if (ReadStateValue(buffer) != SavedStateMagic || version != SavedStateVersion || next >= StateLength)
+				return false;
+
+			for (int i = 0; i < StateLength; i++)
+			{
+				if (static_cast<int>(ReadStateValue(buffer + 12 + i * 4)) < 0)
+					return false;
+			}
+
+			for (int i = 0; i < StateLength; i++)
+			{
+				seedArray[i] = static_cast<int>(ReadStateValue(buffer + 12 + i * 4));
+			}
+
+			iNext = next;
+			iNextP = (next + InitialNextP) % StateLength;
+			seed = static_cast<int>(ReadStateValue(buffer + 8));
+			parallelFills = ReadStateValue(buffer + 12 + StateLength * 4);
+			return true;
+		}
+
+		/// <summary>
+		/// Converts a sample into a float within the range [0, 1) or [0, 1].
+		/// </summary>
+		constexpr float SampleToRange(int sample, bool inclusive)
+		{
+			int max = std::numeric_limits<int>::max();
+
+			if (inclusive)
+				max -= 1;
+
+			return sample * (1.0f / max);
+		}
+
+		/// <summary>
+		/// Converts a sample into an integer within the range [minValue, maxValue).
+		/// The range and the result are computed as unsigned and wrap exactly as the managed engine does for ranges above int.MaxValue, without signed overflow.
+		/// </summary>
+		constexpr int SampleToInteger(int sample, int minValue, int maxValue)
+		{
+			long range = static_cast<int>(static_cast<std::uint32_t>(maxValue) - static_cast<std::uint32_t>(minValue));
+			return static_cast<int>(static_cast<std::uint32_t>(static_cast<int>(SampleToRange(sample, false) * range)) + static_cast<std::uint32_t>(minValue));
+		}
+
+		/// <summary>
+		/// Converts a sample into a float within the range [minValue, minValue + range].
+		/// </summary>
+		constexpr float SampleToFloat(int sample, float minValue, double range)
+		{
+			return static_cast<float>(static_cast<double>(SampleToRange(sample, true) * range)) + minValue;
+		}
+
+		/// <summary>
+		/// Scales a sample within the range [0, 2147483647] to an integer within the range [minValue, maxValue) without rounding through a float.
+		/// </summary>
+		constexpr int ScaleSample(int sample, int minValue, int maxValue)
+		{
+			long long range = static_cast<long long>(maxValue) - minValue;
+			return static_cast<int>(minValue + ((sample * range) >> 31));
+		}
+
+		/// <summary>
+		/// Combines two samples into a double within the range [0, 1) with a full 53-bit mantissa.
+		/// The first sample supplies the high 26 bits and the second the low 27 bits, so every multiple of 2^-53 is reachable and 1.0 never is.
+		/// </summary>
+		constexpr double SamplesToDouble(int high, int low)
+		{
+			return ((high >> 5) * 134217728.0 + (low >> 4)) * (1.0 / 9007199254740992.0);
+		}
+
+		struct SampleConverter
+		{
+			constexpr int operator()(int sample) const { return sample; }
+		};
+
+		struct IntegerConverter
+		{
+			int minValue;
+			int maxValue;
+
+			constexpr int operator()(int sample) const { return SampleToInteger(sample, minValue, maxValue); }
+		};
+
+		struct ByteConverter
+		{
+			int minValue;
+			int maxValue;
+
+			constexpr unsigned char operator()(int sample) const { return static_cast<unsigned char>(SampleToInteger(sample, minValue, maxValue)); }
+		};
+
+		struct UnitFloatConverter
+		{
+			constexpr float operator()(int sample) const { return SampleToRange(sample, true); }
+		};
+
+		struct FloatConverter
+		{
+			float minValue;
+			double range;
+
+			constexpr float operator()(int sample) const { return SampleToFloat(sample, minValue, range); }
+		};
+
+		struct BooleanConverter
+		{
+			constexpr bool operator()(int sample) const { return SampleToInteger(sample, 0, 2) == 1; }
+		};
+
+		struct ProbabilityConverter
+		{
+			float percent;
+
+			constexpr bool operator()(int sample) const { return SampleToRange(sample, true) < percent; }
+		};
+
+		struct PercentConverter
+		{
+			int percent;
+
+			constexpr bool operator()(int sample) const { return SampleToInteger(sample, 0, 100) < percent; }
+		};
+
+		struct ScaledIntegerConverter
+		{
+			int minValue;
+			int maxValue;
+
+			constexpr int operator()(int sample) const { return ScaleSample(sample, minValue, maxValue); }
+		};
+
+		/// <summary>
+		/// Finds the first outcome whose cumulative weight is greater than the specified index.
+		/// </summary>
+		/// <param name="cumulativeWeights">The ascending cumulative weights of the outcomes.</param>
+		/// <param name="count">The number of outcomes.</param>
+		/// <param name="index">The index within the range [0, total weight).</param>
+		/// <returns>The index of the outcome, or count when the index is not below the total weight.</returns>
+		constexpr int FindWeightedIndex(const int* cumulativeWeights, int count, int index)
+		{
+			int low = 0;
+			int high = count;
+
+			while (low < high)
+			{
+				int middle = low + (high - low) / 2;
+
+				if (cumulativeWeights[middle] <= index)
+					low = middle + 1;
+				else
+					high = middle;
+			}
+
+			return low;
+		}
+
+		struct UnitDoubleConverter
+		{
+			constexpr double operator()(int high, int low) const { return SamplesToDouble(high, low); }
+		};
+
+		struct DoubleConverter
+		{
+			double minValue;
+			double range;
+
+			constexpr double operator()(int high, int low) const { return minValue + SamplesToDouble(high, low) * range; }
+		};
+
+		template <typename T>
+		AURORA_CHAOS_CONSTEXPR20 void FillValue(T* buffer, int length, T value)
+		{
+			for (int i = 0; i < length; i++)
+			{
+				buffer[i] = value;
+			}
+		}
+
+		/// <summary>
+		/// Converts the next samples of the seed array into values and stores them in the buffer.
+		/// </summary>
+		template <typename T, typename TConverter>
+		AURORA_CHAOS_CONSTEXPR20 void GenerateValues(int* seedArray, int& iNext, int& iNextP, T* buffer, int length, TConverter converter)
+		{
+			int samples[SampleChunk];
+
+			for (int offset = 0; offset < length; offset += SampleChunk)
+			{
+				int count = length - offset < SampleChunk ? length - offset : SampleChunk;
+				GenerateSamples(seedArray, iNext, iNextP, samples, count);
+
+				for (int i = 0; i < count; i++)
+				{
+					buffer[offset + i] = converter(samples[i]);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Converts the next samples of the seed array into values two samples at a time and stores them in the buffer.
+		/// The samples are generated in blocks and the conversion loop has no branches, so it can be vectorized.
+		/// </summary>
+		template <typename T, typename TConverter>
+		AURORA_CHAOS_CONSTEXPR20 void GeneratePairedValues(int* seedArray, int& iNext, int& iNextP, T* buffer, int length, TConverter converter)
+		{
+			int samples[SampleChunk];
+
+			for (int offset = 0; offset < length; offset += SampleChunk / 2)
+			{
+				int count = length - offset < SampleChunk / 2 ? length - offset : SampleChunk / 2;
+				GenerateSamples(seedArray, iNext, iNextP, samples, count * 2);
+
+				for (int i = 0; i < count; i++)
+				{
+					buffer[offset + i] = converter(samples[i * 2], samples[i * 2 + 1]);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Splits the bits of the next samples of the seed array into values and stores them in the buffer.
+		/// Every sample supplies 31 bits; the first bit of a value is its least significant bit.
+		/// </summary>
+		template <typename T>
+		AURORA_CHAOS_CONSTEXPR20 void GeneratePackedValues(int* seedArray, int& iNext, int& iNextP, T* buffer, int length, int bitsPerValue)
+		{
+			int samples[SampleChunk];
+			long long remaining = (static_cast<long long>(length) * bitsPerValue + 30) / 31;
+			unsigned long long value = 0;
+			int filled = 0;
+			int written = 0;
+
+			while (written < length)
+			{
+				int count = remaining < SampleChunk ? static_cast<int>(remaining) : SampleChunk;
+				GenerateSamples(seedArray, iNext, iNextP, samples, count);
+				remaining -= count;
+
+				for (int i = 0; i < count; i++)
+				{
+					unsigned long long bits = static_cast<unsigned long long>(samples[i]);
+					int available = 31;
+
+					while (available > 0 && written < length)
+					{
+						int take = available < bitsPerValue - filled ? available : bitsPerValue - filled;
+
+						value |= (bits & ((1ULL << take) - 1)) << filled;
+						bits >>= take;
+						available -= take;
+						filled += take;
+
+						if (filled == bitsPerValue)
+						{
+							buffer[written++] = static_cast<T>(value);
+							value = 0;
+							filled = 0;
+						}
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Gets the number of random bits a precise integer of the specified range is drawn from: 31 from one sample, or 32 from two samples for ranges above 2^31.
+		/// </summary>
+		constexpr int PreciseSampleBits(std::uint32_t range)
+		{
+			return range > 0x80000000u ? 32 : 31;
+		}
+
+		/// <summary>
+		/// Draws the random bits a precise integer is made from.
+		/// With 32 bits the second sample supplies only the highest bit.
+		/// </summary>
+		constexpr std::uint32_t NextPreciseBits(int* seedArray, int& iNext, int& iNextP, int bits)
+		{
+			std::uint32_t value = static_cast<std::uint32_t>(NextSample(seedArray, iNext, iNextP));
+
+			if (bits == 32)
+			{
+				value |= static_cast<std::uint32_t>(NextSample(seedArray, iNext, iNextP)) << 31;
+			}
+
+			return value;
+		}
+
+		/// <summary>
+		/// Generates an integer within the range [minValue, maxValue) with Lemire's multiply and reject method.
+		/// Every integer of the range is equally likely and no division is needed unless the first draw lands in the biased region.
+		/// Rejected draws consume further samples, so the number of samples used varies.
+		/// </summary>
+		constexpr int NextPreciseInteger(int* seedArray, int& iNext, int& iNextP, int minValue, int maxValue)
+		{
+			std::uint32_t range = static_cast<std::uint32_t>(maxValue) - static_cast<std::uint32_t>(minValue);
+			int bits = PreciseSampleBits(range);
+			std::uint64_t mask = (1ULL << bits) - 1;
+			std::uint64_t product = static_cast<std::uint64_t>(NextPreciseBits(seedArray, iNext, iNextP, bits)) * range;
+
+			if ((product & mask) < range)
+			{
+				std::uint64_t threshold = ((1ULL << bits) - range) % range;
+
+				while ((product & mask) < threshold)
+				{
+					product = static_cast<std::uint64_t>(NextPreciseBits(seedArray, iNext, iNextP, bits)) * range;
+				}
+			}
+
+			return static_cast<int>(static_cast<std::uint32_t>(minValue) + static_cast<std::uint32_t>(product >> bits));
+		}
+
+		/// <summary>
+		/// Generates integers within the range [minValue, maxValue) with Lemire's multiply and reject method and stores them in the buffer.
+		/// Samples are generated in blocks that never exceed the number still needed, so the state ends exactly where calling NextPreciseInteger length times would leave it.
+		/// </summary>
+		template <typename T>
+		AURORA_CHAOS_CONSTEXPR20 void GeneratePreciseValues(int* seedArray, int& iNext, int& iNextP, T* buffer, int length, int minValue, int maxValue)
+		{
+			std::uint32_t range = static_cast<std::uint32_t>(maxValue) - static_cast<std::uint32_t>(minValue);
+			int bits = PreciseSampleBits(range);
+			int perValue = bits == 32 ? 2 : 1;
+			std::uint64_t mask = (1ULL << bits) - 1;
+			std::uint64_t threshold = ((1ULL << bits) - range) % range;
+
+			int samples[SampleChunk];
+			int written = 0;
+
+			while (written < length)
+			{
+				long long needed = static_cast<long long>(length - written) * perValue;
+				int count = needed < SampleChunk ? static_cast<int>(needed) : SampleChunk;
+				GenerateSamples(seedArray, iNext, iNextP, samples, count);
+
+				for (int i = 0; i < count; i += perValue)
+				{
+					std::uint32_t value = static_cast<std::uint32_t>(samples[i]);
+
+					if (perValue == 2)
+					{
+						value |= static_cast<std::uint32_t>(samples[i + 1]) << 31;
+					}
+
+					std::uint64_t product = static_cast<std::uint64_t>(value) * range;
+
+					if ((product & mask) >= threshold)
+					{
+						buffer[written++] = static_cast<T>(static_cast<int>(static_cast<std::uint32_t>(minValue) + static_cast<std::uint32_t>(product >> bits)));
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Combines three samples into a 64-bit value: 31 bits from the first, 31 from the second and the lowest two bits of the third.
+		/// </summary>
+		constexpr std::uint64_t SamplesToUInt64(int low, int middle, int high)
+		{
+			return static_cast<std::uint64_t>(static_cast<std::uint32_t>(low)) | (static_cast<std::uint64_t>(static_cast<std::uint32_t>(middle)) << 31) | (static_cast<std::uint64_t>(static_cast<std::uint32_t>(high)) << 62);
+		}
+
+		/// <summary>
+		/// Multiplies two 64-bit values into a 128-bit product and returns its high half, storing the low half.
+		/// Built from 32-bit halves, since a native 128-bit type is not available on every target.
+		/// </summary>
+		constexpr std::uint64_t MultiplyWide(std::uint64_t left, std::uint64_t right, std::uint64_t& low)
+		{
+			std::uint64_t leftLow = left & 0xFFFFFFFFu;
+			std::uint64_t leftHigh = left >> 32;
+			std::uint64_t rightLow = right & 0xFFFFFFFFu;
+			std::uint64_t rightHigh = right >> 32;
+
+			std::uint64_t lowLow = leftLow * rightLow;
+			std::uint64_t highLow = leftHigh * rightLow;
+			std::uint64_t lowHigh = leftLow * rightHigh;
+			std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + (lowHigh & 0xFFFFFFFFu);
+
+			low = (middle << 32) | (lowLow & 0xFFFFFFFFu);
+			return leftHigh * rightHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+		}
+
+		/// <summary>
+		/// Generates a 64-bit value within the range [0, range) from three samples per draw with Lemire's multiply and reject method.
+		/// A range of zero stands for the full 64-bit range and never rejects.
+		/// </summary>
+		constexpr std::uint64_t NextWideInteger(int* seedArray, int& iNext, int& iNextP, std::uint64_t range)
+		{
+			int low = NextSample(seedArray, iNext, iNextP);
+			int middle = NextSample(seedArray, iNext, iNextP);
+			std::uint64_t value = SamplesToUInt64(low, middle, NextSample(seedArray, iNext, iNextP));
+
+			if (range == 0)
+				return value;
+
+			std::uint64_t fraction = 0;
+			std::uint64_t retVal = MultiplyWide(value, range, fraction);
+
+			if (fraction < range)
+			{
+				std::uint64_t threshold = (0 - range) % range;
+
+				while (fraction < threshold)
+				{
+					low = NextSample(seedArray, iNext, iNextP);
+					middle = NextSample(seedArray, iNext, iNextP);
+					value = SamplesToUInt64(low, middle, NextSample(seedArray, iNext, iNextP));
+					retVal = MultiplyWide(value, range, fraction);
+				}
+			}
+
+			return retVal;
+		}
+
+		/// <summary>
+		/// Generates 64-bit values within the range [minValue, minValue + range) and stores them in the buffer, wrapping around 2^64.
+		/// A range of zero stands for the full 64-bit range.
+		/// Samples are generated in blocks that never exceed the number still needed, so the state ends exactly where calling NextWideInteger length times would leave it.
+		/// </summary>
+		template <typename T>
+		AURORA_CHAOS_CONSTEXPR20 void GenerateWideValues(int* seedArray, int& iNext, int& iNextP, T* buffer, int length, std::uint64_t minValue, std::uint64_t range)
+		{
+			std::uint64_t threshold = range == 0 ? 0 : (0 - range) % range;
+
+			int samples[SampleChunk];
+			int written = 0;
+
+			while (written < length)
+			{
+				int needed = length - written < SampleChunk / 3 ? length - written : SampleChunk / 3;
+				GenerateSamples(seedArray, iNext, iNextP, samples, needed * 3);
+
+				for (int i = 0; i < needed * 3; i += 3)
+				{
+					std::uint64_t value = SamplesToUInt64(samples[i], samples[i + 1], samples[i + 2]);
+
+					if (range == 0)
+					{
+						buffer[written++] = static_cast<T>(minValue + value);
+						continue;
+					}
+
+					std::uint64_t fraction = 0;
+					std::uint64_t retVal = MultiplyWide(value, range, fraction);
+
+					if (fraction >= threshold)
+					{
+						buffer[written++] = static_cast<T>(minValue + retVal);
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Converts a sample to a double within the open range (0, 1), so its logarithm is always finite.
+		/// </summary>
+		constexpr double SampleToOpenUnit(int sample)
+		{
+			return (sample + 0.5) * (1.0 / 2147483648.0);
+		}
+
+		/// <summary>
+		/// The number of rejected tries after which a rejection sampler gives up and returns a fallback value.
+		/// A uniform source practically never needs that many; the limit only guarantees termination on the short cycles the clamped recurrence can fall into.
+		/// </summary>
+		constexpr int RejectionLimit = 16;
+
+		/// <summary>
+		/// The number of layers of the normal ziggurat.
+		/// </summary>
+		constexpr int NormalLayers = 128;
+
+		/// <summary>
+		/// The number of layers of the exponential ziggurat.
+		/// </summary>
+		constexpr int ExponentialLayers = 256;
+
+		/// <summary>
+		/// The scale of the magnitude a ziggurat draws from the bits of a sample left after the layer index.
+		/// </summary>
+		constexpr double ZigguratScale = 8388608.0;
+
+		/// <summary>
+		/// The layer tables of Marsaglia and Tsang's ziggurat method for the normal and exponential distributions.
+		/// For layer i, Limits holds the largest magnitude that is inside the layer below it, Widths the scale from magnitude to value and Heights the density at the edge of the layer.
+		/// </summary>
+		struct ZigguratTables
+		{
+			std::uint32_t NormalLimits[NormalLayers];
+			double NormalWidths[NormalLayers];
+			double NormalHeights[NormalLayers];
+			std::uint32_t ExponentialLimits[ExponentialLayers];
+			double ExponentialWidths[ExponentialLayers];
+			double ExponentialHeights[ExponentialLayers];
+		};
+
+		/// <summary>
+		/// The right edge of the base layer of the normal ziggurat.
+		/// </summary>
+		constexpr double NormalTail = 3.442619855899;
+
+		/// <summary>
+		/// The right edge of the base layer of the exponential ziggurat.
+		/// </summary>
+		constexpr double ExponentialTail = 7.697117470131487;
+
+		/// <summary>
+		/// Computes the ziggurat layer tables for magnitudes of 23 bits.
+		/// </summary>
+		inline ZigguratTables BuildZigguratTables()
+		{
+			ZigguratTables tables = {};
+
+			double edge = NormalTail;
+			double previous = edge;
+			const double normalArea = 9.91256303526217e-3;
+			double q = normalArea / std::exp(-0.5 * edge * edge);
+
+			tables.NormalLimits[0] = static_cast<std::uint32_t>((edge / q) * ZigguratScale);
+			tables.NormalLimits[1] = 0;
+			tables.NormalWidths[0] = q / ZigguratScale;
+			tables.NormalWidths[NormalLayers - 1] = edge / ZigguratScale;
+			tables.NormalHeights[0] = 1.0;
+			tables.NormalHeights[NormalLayers - 1] = std::exp(-0.5 * edge * edge);
+
+			for (int i = NormalLayers - 2; i >= 1; i--)
+			{
+				edge = std::sqrt(-2.0 * std::log(normalArea / edge + std::exp(-0.5 * edge * edge)));
+				tables.NormalLimits[i + 1] = static_cast<std::uint32_t>((edge / previous) * ZigguratScale);
+				previous = edge;
+				tables.NormalHeights[i] = std::exp(-0.5 * edge * edge);
+				tables.NormalWidths[i] = edge / ZigguratScale;
+			}
+
+			edge = ExponentialTail;
+			previous = edge;
+			const double exponentialArea = 3.949659822581572e-3;
+			q = exponentialArea / std::exp(-edge);
+
+			tables.ExponentialLimits[0] = static_cast<std::uint32_t>((edge / q) * ZigguratScale);
+			tables.ExponentialLimits[1] = 0;
+			tables.ExponentialWidths[0] = q / ZigguratScale;
+			tables.ExponentialWidths[ExponentialLayers - 1] = edge / ZigguratScale;
+			tables.ExponentialHeights[0] = 1.0;
+			tables.ExponentialHeights[ExponentialLayers - 1] = std::exp(-edge);
+
+			for (int i = ExponentialLayers - 2; i >= 1; i--)
+			{
+				edge = -std::log(exponentialArea / edge + std::exp(-edge));
+				tables.ExponentialLimits[i + 1] = static_cast<std::uint32_t>((edge / previous) * ZigguratScale);
+				previous = edge;
+				tables.ExponentialHeights[i] = std::exp(-edge);
+				tables.ExponentialWidths[i] = edge / ZigguratScale;
+			}
+
+			return tables;
+		}
+
+		/// <summary>
+		/// Gets the ziggurat layer tables, computing them on first use.
+		/// </summary>
+		inline const ZigguratTables& GetZigguratTables()
+		{
+			static const ZigguratTables tables = BuildZigguratTables();
+			return tables;
+		}
+
+		/// <summary>
+		/// Generates a standard normal value with the ziggurat method.
+		/// The low 7 bits of a sample select the layer and the remaining 24 bits give a signed magnitude; about 99% of values take one sample and one multiply.
+		/// </summary>
+		inline double NextNormal(int* seedArray, int& iNext, int& iNextP)
+		{
+			const ZigguratTables& tables = GetZigguratTables();
+
+			for (int attempt = 0;; attempt++)
+			{
+				int sample = NextSample(seedArray, iNext, iNextP);
+				int layer = sample & (NormalLayers - 1);
+				int magnitude = (sample >> 7) - (1 << 23);
+				std::uint32_t absolute = static_cast<std::uint32_t>(magnitude < 0 ? -magnitude : magnitude);
+				double x = magnitude * tables.NormalWidths[layer];
+
+				if (absolute < tables.NormalLimits[layer] || attempt >= RejectionLimit)
+					return x;
+
+				if (layer == 0)
+				{
+					double tail = 0;
+
+					for (int tries = 0; tries < RejectionLimit; tries++)
+					{
+						tail = -std::log(SampleToOpenUnit(NextSample(seedArray, iNext, iNextP))) / NormalTail;
+						double y = -std::log(SampleToOpenUnit(NextSample(seedArray, iNext, iNextP)));
+
+						if (y + y >= tail * tail)
+							break;
+					}
+
+					return magnitude < 0 ? -NormalTail - tail : NormalTail + tail;
+				}
+
+				double u = SampleToOpenUnit(NextSample(seedArray, iNext, iNextP));
+
+				if (tables.NormalHeights[layer] + u * (tables.NormalHeights[layer - 1] - tables.NormalHeights[layer]) < std::exp(-0.5 * x * x))
+					return x;
+			}
+		}
+
+		/// <summary>
+		/// Generates a standard exponential value with the ziggurat method.
+		/// The low 8 bits of a sample select the layer and the remaining 23 bits give the magnitude; about 99% of values take one sample and one multiply.
+		/// </summary>
+		inline double NextExponential(int* seedArray, int& iNext, int& iNextP)
+		{
+			const ZigguratTables& tables = GetZigguratTables();
+
+			for (int attempt = 0;; attempt++)
+			{
+				int sample = NextSample(seedArray, iNext, iNextP);
+				int layer = sample & (ExponentialLayers - 1);
+				std::uint32_t magnitude = static_cast<std::uint32_t>(sample) >> 8;
+				double x = magnitude * tables.ExponentialWidths[layer];
+
+				if (magnitude < tables.ExponentialLimits[layer] || attempt >= RejectionLimit)
+					return x;
+
+				if (layer == 0)
+					return ExponentialTail - std::log(SampleToOpenUnit(NextSample(seedArray, iNext, iNextP)));
+
+				double u = SampleToOpenUnit(NextSample(seedArray, iNext, iNextP));
+
+				if (tables.ExponentialHeights[layer] + u * (tables.ExponentialHeights[layer - 1] - tables.ExponentialHeights[layer]) < std::exp(-x))
+					return x;
+			}
+		}
+
+		struct NormalDistribution
+		{
+			double mean;
+			double standardDeviation;
+
+			double operator()(int* seedArray, int& iNext, int& iNextP) const { return mean + standardDeviation * NextNormal(seedArray, iNext, iNextP); }
+		};
+
+		struct ExponentialDistribution
+		{
+			double lambda;
+
+			double operator()(int* seedArray, int& iNext, int& iNextP) const { return NextExponential(seedArray, iNext, iNextP) / lambda; }
+		};
+
+		/// <summary>
+		/// Represents a Poisson distribution with its sampling constants computed once.
+		/// Means below 10 are sampled by inversion with one sample per value; larger means use Hörmann's transformed rejection with squeeze (PTRS), which takes two samples per try and accepts about 90% of tries.
+		/// </summary>
+		class PoissonDistribution
+		{
+		public:
+			/// <summary>
+			/// Initializes a new instance of the PoissonDistribution class with the specified mean.
+			/// </summary>
+			/// <param name="mean">The mean, not negative.</param>
+			explicit PoissonDistribution(double mean) : _mean(mean)
+			{
+				if (mean < 10)
+				{
+					_limit = std::exp(-mean);
+					return;
+				}
+
+				double root = std::sqrt(mean);
+				_logMean = std::log(mean);
+				_b = 0.931 + 2.53 * root;
+				_a = -0.059 + 0.02483 * _b;
+				_logAlpha = std::log(1.1239 + 1.1328 / (_b - 3.4));
+				_squeeze = 0.9277 - 3.6224 / (_b - 2);
+			}
+
+			int operator()(int* seedArray, int& iNext, int& iNextP) const
+			{
+				if (_mean <= 0)
+					return 0;
+
+				if (_mean < 10)
+				{
+					double u = SampleToOpenUnit(NextSample(seedArray, iNext, iNextP));
+					double probability = _limit;
+					int k = 0;
+
+					while (u > probability && k < 1000)
+					{
+						u -= probability;
+						k++;
+						probability *= _mean / k;
+					}
+
+					return k;
+				}
+
+				for (int attempt = 0;; attempt++)
+				{
+					double u = SampleToOpenUnit(NextSample(seedArray, iNext, iNextP)) - 0.5;
+					double v = SampleToOpenUnit(NextSample(seedArray, iNext, iNextP));
+					double us = 0.5 - std::fabs(u);
+					double k = std::floor((2 * _a / us + _b) * u + _mean + 0.43);
+
+					if (us >= 0.07 && v <= _squeeze)
+						return static_cast<int>(k);
+
+					if (attempt >= RejectionLimit)
+						return static_cast<int>(_mean);
+
+					if (k < 0 || (us < 0.013 && v > us))
+						continue;
+
+					if (std::log(v) + _logAlpha - std::log(_a / (us * us) + _b) <= -_mean + k * _logMean - std::lgamma(k + 1))
+						return static_cast<int>(k);
+				}
+			}
+
+		private:
+			double _mean;
+			double _limit = 0;
+			double _logMean = 0;
+			double _a = 0;
+			double _b = 0;
+			double _logAlpha = 0;
+			double _squeeze = 0;
+		};
+
+		/// <summary>
+		/// Represents a binomial distribution with its sampling constants computed once.
+		/// The probability is folded to at most one half by symmetry; distributions whose mean is then below 10 are sampled by inversion with one sample per value, larger ones use Hörmann's transformed rejection (BTRS), which takes two samples per try independent of the number of trials.
+		/// </summary>
+		class BinomialDistribution
+		{
+		public:
+			/// <summary>
+			/// Initializes a new instance of the BinomialDistribution class with the specified number of trials and probability of success.
+			/// </summary>
+			/// <param name="trials">The number of trials, not negative.</param>
+			/// <param name="probability">The probability of success of every trial.</param>
+			BinomialDistribution(int trials, double probability) : _trials(trials)
+			{
+				if (!(probability > 0) || probability >= 1)
+				{
+					_fixed = probability >= 1 ? trials : 0;
+					return;
+				}
+
+				_flipped = probability > 0.5;
+				_p = _flipped ? 1 - probability : probability;
+
+				double q = 1 - _p;
+				double mean = trials * _p;
+
+				if (mean < 10)
+				{
+					_limit = std::pow(q, trials);
+					_ratio = _p / q;
+					return;
+				}
+
+				double spread = std::sqrt(mean * q);
+				_b = 1.15 + 2.53 * spread;
+				_a = -0.0873 + 0.0248 * _b + 0.01 * _p;
+				_c = mean + 0.5;
+				_squeeze = 0.92 - 4.2 / _b;
+				_alpha = (2.83 + 5.1 / _b) * spread;
+				_logRatio = std::log(_p / q);
+				_mode = std::floor((trials + 1) * _p);
+				_logModeTerms = std::lgamma(_mode + 1) + std::lgamma(trials - _mode + 1);
+			}
+
+			int operator()(int* seedArray, int& iNext, int& iNextP) const
+			{
+				if (_fixed >= 0)
+					return _fixed;
+
+				int successes = Sample(seedArray, iNext, iNextP);
+				return _flipped ? _trials - successes : successes;
+			}
+
+		private:
+			int _trials;
+			int _fixed = -1;
+			bool _flipped = false;
+			double _p = 0;
+			double _limit = 0;
+			double _ratio = 0;
+			double _a = 0;
+			double _b = 0;
+			double _c = 0;
+			double _squeeze = 0;
+			double _alpha = 0;
+			double _logRatio = 0;
+			double _mode = 0;
+			double _logModeTerms = 0;
+
+			int Sample(int* seedArray, int& iNext, int& iNextP) const
+			{
+				if (_b == 0)
+				{
+					double u = SampleToOpenUnit(NextSample(seedArray, iNext, iNextP));
+					double probability = _limit;
+					int k = 0;
+
+					while (u > probability && k < _trials)
+					{
+						u -= probability;
+						k++;
+						probability *= (_trials - k + 1) * _ratio / k;
+					}
+
+					return k;
+				}
+
+				for (int attempt = 0;; attempt++)
+				{
+					double u = SampleToOpenUnit(NextSample(seedArray, iNext, iNextP)) - 0.5;
+					double v = SampleToOpenUnit(NextSample(seedArray, iNext, iNextP));
+					double us = 0.5 - std::fabs(u);
+					double k = std::floor((2 * _a / us + _b) * u + _c);
+
+					if (attempt >= RejectionLimit)
+						return static_cast<int>(_mode);
+
+					if (k < 0 || k > _trials)
+						continue;
+
+					if (us >= 0.07 && v <= _squeeze)
+						return static_cast<int>(k);
+
+					if (std::log(v * _alpha / (_a / (us * us) + _b)) <= _logModeTerms - std::lgamma(k + 1) - std::lgamma(_trials - k + 1) + (k - _mode) * _logRatio)
+						return static_cast<int>(k);
+				}
+			}
+		};
+
+		/// <summary>
+		/// Distributes a number of trials over outcomes with the specified weights, as a chain of binomial draws of the trials left over the weight left.
+		/// It takes at most one binomial value per outcome, however many trials there are.
+		/// </summary>
+		/// <param name="trials">The number of trials, not negative.</param>
+		/// <param name="weights">The weights of the outcomes; weights that are not greater than zero are never chosen.</param>
+		/// <param name="count">The number of outcomes.</param>
+		/// <param name="totalWeight">The sum of the weights greater than zero, greater than zero and finite.</param>
+		/// <param name="counts">The buffer to store the number of trials of every outcome.</param>
+		inline void GenerateMultinomial(int* seedArray, int& iNext, int& iNextP, int trials, const double* weights, int count, double totalWeight, int* counts)
+		{
+			double remainingWeight = totalWeight;
+			int last = count - 1;
+
+			while (last > 0 && !(weights[last] > 0))
+			{
+				last--;
+			}
+
+			for (int i = 0; i < count; i++)
+			{
+				double weight = weights[i] > 0 ? weights[i] : 0;
+				int drawn = 0;
+
+				if (i == last)
+					drawn = trials;
+				else if (trials > 0 && weight > 0)
+					drawn = BinomialDistribution(trials, weight / remainingWeight)(seedArray, iNext, iNextP);
+
+				counts[i] = drawn;
+				trials -= drawn;
+				remainingWeight -= weight;
+			}
+		}
+
+		/// <summary>
+		/// Draws values from a distribution and stores them in the buffer.
+		/// Distributions with rejection use a varying number of samples per value, so the samples are drawn one at a time and the state ends exactly where drawing the values one by one would leave it.
+		/// </summary>
+		template <typename T, typename TDistribution>
+		inline void GenerateDistributionValues(int* seedArray, int& iNext, int& iNextP, T* buffer, int length, const TDistribution& distribution)
+		{
+			for (int i = 0; i < length; i++)
+			{
+				buffer[i] = static_cast<T>(distribution(seedArray, iNext, iNextP));
+			}
+		}
+
+		/// <summary>
+		/// The largest probability for which a sparse fill draws the gaps between true values instead of one sample per value.
+		/// Above it the logarithms cost more than the samples they save.
+		/// </summary>
+		constexpr double SparseProbabilityLimit = 0.125;
+
+		/// <summary>
+		/// Finds the index of the next true value of a boolean sequence with the specified probability, starting at the specified index.
+		/// The number of false values before it is geometric and drawn by inversion from one sample; low samples give short gaps, just as they give true values in ProbabilityConverter.
+		/// </summary>
+		/// <param name="start">The index to start at.</param>
+		/// <param name="length">The number of values of the sequence.</param>
+		/// <param name="logFailure">The logarithm of the probability of being false, less than zero.</param>
+		/// <returns>The index of the next true value, or length when there is none.</returns>
+		inline int NextSparseIndex(int* seedArray, int& iNext, int& iNextP, int start, int length, double logFailure)
+		{
+			double gap = std::floor(std::log1p(-SampleToOpenUnit(NextSample(seedArray, iNext, iNextP))) / logFailure);
+			return gap < static_cast<double>(length) - start ? start + static_cast<int>(gap) : length;
+		}
+
+		/// <summary>
+		/// Generates boolean values with the specified probability of being true by clearing the buffer and drawing the gaps between the true values.
+		/// It takes one sample per true value and one more for the final gap, so it suits probabilities up to SparseProbabilityLimit.
+		/// </summary>
+		/// <param name="percent">The probability of being true, greater than zero and less than one.</param>
+		inline void GenerateSparseProbabilities(int* seedArray, int& iNext, int& iNextP, bool* buffer, int length, double percent)
+		{
+			double logFailure = std::log1p(-percent);
+			std::memset(buffer, 0, static_cast<std::size_t>(length) * sizeof(bool));
+
+			for (int i = NextSparseIndex(seedArray, iNext, iNextP, 0, length, logFailure); i < length; i = NextSparseIndex(seedArray, iNext, iNextP, i + 1, length, logFailure))
+			{
+				buffer[i] = true;
+			}
+		}
+
+		/// <summary>
+		/// Represents the state of a chaos engine without any managed dependencies.
+		/// Produces the same sequences as the managed ChaosEngine for the same integer seed.
+		/// Seeding and scalar sampling are constexpr; the bulk methods are constexpr when compiled as C++20.
+		/// Arguments are not validated; they must satisfy the preconditions the managed ChaosEngine checks.
+		/// </summary>
+		class ChaosCore
+		{
+		public:
+			/// <summary>
+			/// The type of the samples returned by the function call operator.
+			/// </summary>
+			typedef std::uint32_t result_type;
+
+			/// <summary>
+			/// Gets the smallest sample the chaos core can generate.
+			/// </summary>
+			static constexpr result_type min() { return 0; }
+
+			/// <summary>
+			/// Gets the largest sample the chaos core can generate.
+			/// </summary>
+			static constexpr result_type max() { return static_cast<result_type>(std::numeric_limits<int>::max()); }
+
+			/// <summary>
+			/// Initializes a new instance of the ChaosCore class with the specified seed.
+			/// </summary>
+			/// <param name="seed">The seed value.</param>
+			constexpr explicit ChaosCore(int seed)
+			{
+				Reseed(seed);
+			}
+
+			/// <summary>
+			/// Reseeds the chaos core with the specified seed.
+			/// </summary>
+			/// <param name="seed">The seed value.</param>
+			constexpr void Reseed(int seed)
+			{
+				_seed = seed;
+				ReseedState(_seedArray, _iNext, _iNextP, seed);
+			}
+
+			/// <summary>
+			/// Gets the seed the chaos core was last seeded with.
+			/// </summary>
+			/// <returns>The seed value.</returns>
+			constexpr int Seed() const
+			{
+				return _seed;
+			}
+
+			/// <summary>
+			/// Creates an independent child from the state of the chaos core without reseeding.
+			/// The child masks a copy of the state with a keystream keyed by a digest of it, and the chaos core re-keys itself the same way, so repeated forks never repeat a child.
+			/// </summary>
+			/// <returns>The child chaos core.</returns>
+			constexpr ChaosCore Fork()
+			{
+				ChaosCore child = *this;
+				Fork(&child, 1);
+				return child;
+			}
+
+			/// <summary>
+			/// Creates independent children from the state of the chaos core, digesting the state once.
+			/// Every child after the first only costs its own mask of 55 entries.
+			/// </summary>
+			/// <param name="children">The buffer to store the children.</param>
+			/// <param name="count">The number of children.</param>
+			constexpr void Fork(ChaosCore* children, int count)
+			{
+				int samples[StateLength] = {};
+				CopyRing(_seedArray, _iNext, samples);
+				std::uint64_t digest = DigestSamples(samples, StateLength, 0);
+
+				for (int i = 0; i < count; i++)
+				{
+					ChaosCore& child = children[i];
+					ForkState(samples, digest, i + 1, child._seedArray, child._iNext, child._iNextP);
+					child._seed = DeriveSeed(_seed, child._seedArray[0]);
+				}
+
+				ForkState(samples, digest, 0, _seedArray, _iNext, _iNextP);
+			}
+
+			/// <summary>
+			/// Writes the state of the chaos core to a buffer of SavedStateSize bytes.
+			/// The chaos core has no parallel fills, so the recorded count is zero.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the state.</param>
+			constexpr void SaveState(unsigned char* buffer) const
+			{
+				Native::SaveState(buffer, _seedArray, _iNext, _seed, 0);
+			}
+
+			/// <summary>
+			/// Restores a state written by SaveState, here or by the managed ChaosEngine; the recorded number of parallel fills is not kept.
+			/// </summary>
+			/// <param name="buffer">The buffer of SavedStateSize bytes holding the state.</param>
+			/// <returns>true if the state was restored; false if the buffer does not hold a valid state.</returns>
+			constexpr bool LoadState(const unsigned char* buffer)
+			{
+				std::uint32_t parallelFills = 0;
+				return Native::LoadState(buffer, _seedArray, _iNext, _iNextP, _seed, parallelFills);
+			}
+
+			/// <summary>
+			/// Generates the next random sample.
+			/// </summary>
+			/// <returns>A random sample within the range [0, 2147483647].</returns>
+			constexpr result_type operator()()
+			{
+				return static_cast<result_type>(NextSample());
+			}
+
+			/// <summary>
+			/// Generates the next random sample.
+			/// </summary>
+			/// <returns>A random sample.</returns>
+			constexpr int NextSample()
+			{
+				return Native::NextSample(_seedArray, _iNext, _iNextP);
+			}
+
+			/// <summary>
+			/// Writes the next random samples into the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random samples.</param>
+			/// <param name="count">The number of random samples to generate.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextSamples(int* buffer, int count)
+			{
+				GenerateSamples(_seedArray, _iNext, _iNextP, buffer, count);
+			}
+
+			/// <summary>
+			/// Advances the chaos core past the next random samples without generating values from them.
+			/// </summary>
+			/// <param name="count">The number of random samples to skip.</param>
+			AURORA_CHAOS_CONSTEXPR20 void Discard(unsigned long long count)
+			{
+				DiscardSamples(_seedArray, _iNext, _iNextP, count);
+			}
+
+			/// <summary>
+			/// Converts the next random samples into values and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="converter">The function converting a sample into a value.</param>
+			template <typename T, typename TConverter>
+			AURORA_CHAOS_CONSTEXPR20 void NextValues(T* buffer, int length, TConverter converter)
+			{
+				GenerateValues<T>(_seedArray, _iNext, _iNextP, buffer, length, converter);
+			}
+
+			/// <summary>
+			/// Splits the bits of the next random samples into values and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="bitsPerValue">The number of bits in each value, at most 64.</param>
+			template <typename T>
+			AURORA_CHAOS_CONSTEXPR20 void NextPackedValues(T* buffer, int length, int bitsPerValue)
+			{
+				GeneratePackedValues<T>(_seedArray, _iNext, _iNextP, buffer, length, bitsPerValue);
+			}
+
+			/// <summary>
+			/// Generates the next random float value within the range [0, 1) or [0, 1].
+			/// </summary>
+			/// <param name="inclusive">Specifies whether the maximum value is inclusive.</param>
+			/// <returns>A random float value within the specified range.</returns>
+			constexpr float NextRange(bool inclusive)
+			{
+				return SampleToRange(NextSample(), inclusive);
+			}
+
+			/// <summary>
+			/// Generates the next random boolean value.
+			/// </summary>
+			/// <returns>A random boolean value.</returns>
+			constexpr bool NextBoolean()
+			{
+				return NextInteger(0, 2) == 1;
+			}
+
+			/// <summary>
+			/// Generates the next random boolean value with the specified probability of being true.
+			/// </summary>
+			/// <param name="percent">The probability of being true, between 0 and 1.</param>
+			/// <returns>A random boolean value.</returns>
+			constexpr bool NextProbability(float percent)
+			{
+				return percent >= 1 || (percent > 0 && NextFloat() < percent);
+			}
+
+			/// <summary>
+			/// Generates the next random boolean value with the specified probability of being true.
+			/// </summary>
+			/// <param name="percent">The probability of being true, between 0 and 100.</param>
+			/// <returns>A random boolean value.</returns>
+			constexpr bool NextProbability(int percent)
+			{
+				return percent >= 100 || (percent > 0 && NextInteger(0, 100) < percent);
+			}
+
+			/// <summary>
+			/// Generates the next random boolean value that is true with odds of a in b.
+			/// </summary>
+			/// <param name="a">The number of favourable outcomes.</param>
+			/// <param name="b">The number of total outcomes, not zero.</param>
+			/// <returns>A random boolean value.</returns>
+			constexpr bool NextOdds(float a, float b)
+			{
+				return NextProbability(a / b);
+			}
+
+			/// <summary>
+			/// Generates the next random byte value.
+			/// </summary>
+			/// <returns>A random byte value.</returns>
+			constexpr unsigned char NextByte()
+			{
+				return static_cast<unsigned char>(NextInteger(0, 256));
+			}
+
+			/// <summary>
+			/// Generates the next random byte value within the range [minValue, maxValue].
+			/// </summary>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The maximum value, not less than minValue.</param>
+			/// <returns>A random byte value within the specified range.</returns>
+			constexpr unsigned char NextByte(unsigned char minValue, unsigned char maxValue)
+			{
+				if (minValue == maxValue)
+					return minValue;
+
+				return static_cast<unsigned char>(NextInteger(static_cast<int>(minValue), static_cast<int>(maxValue) + 1));
+			}
+
+			/// <summary>
+			/// Generates the next random integer within the range [minValue, maxValue).
+			/// </summary>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The exclusive maximum value, greater than minValue.</param>
+			/// <returns>A random integer within the specified range.</returns>
+			constexpr int NextInteger(int minValue, int maxValue)
+			{
+				if (minValue == maxValue - 1)
+					return minValue;
+
+				return SampleToInteger(NextSample(), minValue, maxValue);
+			}
+
+			/// <summary>
+			/// Generates the next random integer within the range [minValue, maxValue), every integer being equally likely.
+			/// Unlike NextInteger, the result is exact for ranges of any size, at the cost of a different sequence.
+			/// </summary>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The exclusive maximum value, greater than minValue.</param>
+			/// <returns>A random integer within the specified range.</returns>
+			constexpr int NextPreciseInteger(int minValue, int maxValue)
+			{
+				if (minValue == maxValue - 1)
+					return minValue;
+
+				return Native::NextPreciseInteger(_seedArray, _iNext, _iNextP, minValue, maxValue);
+			}
+
+			/// <summary>
+			/// Generates the next random double value within the range [0, 1) from two samples.
+			/// </summary>
+			/// <returns>A random double value with a full 53-bit mantissa.</returns>
+			constexpr double NextDouble()
+			{
+				int high = NextSample();
+				return SamplesToDouble(high, NextSample());
+			}
+
+			/// <summary>
+			/// Generates the next random double value within the range [minValue, maxValue) from two samples.
+			/// </summary>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The exclusive maximum value, not less than minValue.</param>
+			/// <returns>A random double value within the specified range.</returns>
+			constexpr double NextDouble(double minValue, double maxValue)
+			{
+				if (minValue == maxValue)
+					return minValue;
+
+				return minValue + NextDouble() * (maxValue - minValue);
+			}
+
+			/// <summary>
+			/// Generates the next random 64-bit value from three samples.
+			/// </summary>
+			/// <returns>A random value within the range [0, 2^64).</returns>
+			constexpr std::uint64_t NextUInt64()
+			{
+				return NextWideInteger(_seedArray, _iNext, _iNextP, 0);
+			}
+
+			/// <summary>
+			/// Generates the next random non-negative 64-bit integer from three samples.
+			/// </summary>
+			/// <returns>A random integer within the range [0, 9223372036854775807].</returns>
+			constexpr long long NextInt64()
+			{
+				return static_cast<long long>(NextWideInteger(_seedArray, _iNext, _iNextP, 1ULL << 63));
+			}
+
+			/// <summary>
+			/// Generates the next random 64-bit integer within the range [minValue, maxValue), every integer being equally likely.
+			/// </summary>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The exclusive maximum value, greater than minValue.</param>
+			/// <returns>A random integer within the specified range.</returns>
+			constexpr long long NextInt64(long long minValue, long long maxValue)
+			{
+				if (minValue == maxValue - 1)
+					return minValue;
+
+				std::uint64_t range = static_cast<std::uint64_t>(maxValue) - static_cast<std::uint64_t>(minValue);
+				return static_cast<long long>(static_cast<std::uint64_t>(minValue) + NextWideInteger(_seedArray, _iNext, _iNextP, range));
+			}
+
+			/// <summary>
+			/// Generates the next random value of a normal distribution with the ziggurat method.
+			/// </summary>
+			/// <param name="mean">The mean of the distribution.</param>
+			/// <param name="standardDeviation">The standard deviation of the distribution, not negative.</param>
+			/// <returns>A random value of the distribution.</returns>
+			double NextGaussian(double mean, double standardDeviation)
+			{
+				return NormalDistribution{ mean, standardDeviation }(_seedArray, _iNext, _iNextP);
+			}
+
+			/// <summary>
+			/// Generates the next random value of an exponential distribution with the ziggurat method.
+			/// </summary>
+			/// <param name="lambda">The rate of the distribution, greater than zero.</param>
+			/// <returns>A random value of the distribution.</returns>
+			double NextExponential(double lambda)
+			{
+				return ExponentialDistribution{ lambda }(_seedArray, _iNext, _iNextP);
+			}
+
+			/// <summary>
+			/// Generates the next random value of a Poisson distribution.
+			/// </summary>
+			/// <param name="mean">The mean of the distribution, not negative.</param>
+			/// <returns>A random value of the distribution.</returns>
+			int NextPoisson(double mean)
+			{
+				return PoissonDistribution(mean)(_seedArray, _iNext, _iNextP);
+			}
+
+			/// <summary>
+			/// Generates the next number of successes of a number of trials with the specified probability of success.
+			/// </summary>
+			/// <param name="trials">The number of trials, not negative.</param>
+			/// <param name="probability">The probability of success of every trial, between 0 and 1.</param>
+			/// <returns>A random number of successes within the range [0, trials].</returns>
+			int NextBinomial(int trials, double probability)
+			{
+				return BinomialDistribution(trials, probability)(_seedArray, _iNext, _iNextP);
+			}
+
+			/// <summary>
+			/// Distributes a number of trials over outcomes with the specified weights.
+			/// </summary>
+			/// <param name="trials">The number of trials, not negative.</param>
+			/// <param name="weights">The weights of the outcomes, with at least one greater than zero.</param>
+			/// <param name="count">The number of outcomes.</param>
+			/// <param name="counts">The buffer to store the number of trials of every outcome.</param>
+			void NextMultinomial(int trials, const double* weights, int count, int* counts)
+			{
+				double totalWeight = 0;
+
+				for (int i = 0; i < count; i++)
+				{
+					if (weights[i] > 0)
+						totalWeight += weights[i];
+				}
+
+				GenerateMultinomial(_seedArray, _iNext, _iNextP, trials, weights, count, totalWeight, counts);
+			}
+
+			/// <summary>
+			/// Generates the index of a random outcome with the specified cumulative weights.
+			/// </summary>
+			/// <param name="cumulativeWeights">The ascending cumulative weights of the outcomes, the last greater than zero.</param>
+			/// <param name="count">The number of outcomes, at least one.</param>
+			/// <returns>The index of an outcome with a weight greater than zero.</returns>
+			constexpr int NextWeightedIndex(const int* cumulativeWeights, int count)
+			{
+				return FindWeightedIndex(cumulativeWeights, count, ScaleSample(NextSample(), 0, cumulativeWeights[count - 1]));
+			}
+
+			/// <summary>
+			/// Draws random values from a distribution and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="distribution">The distribution, such as NormalDistribution, ExponentialDistribution or PoissonDistribution.</param>
+			template <typename T, typename TDistribution>
+			void NextDistributionValues(T* buffer, int length, const TDistribution& distribution)
+			{
+				GenerateDistributionValues<T>(_seedArray, _iNext, _iNextP, buffer, length, distribution);
+			}
+
+			/// <summary>
+			/// Generates the next random float value within the range [0, 1].
+			/// </summary>
+			/// <returns>A random float value.</returns>
+			constexpr float NextFloat()
+			{
+				return NextRange(true);
+			}
+
+			/// <summary>
+			/// Generates the next random float value within the range [minValue, maxValue].
+			/// </summary>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The maximum value, not less than minValue.</param>
+			/// <returns>A random float value within the specified range.</returns>
+			constexpr float NextFloat(float minValue, float maxValue)
+			{
+				if (minValue == maxValue)
+					return minValue;
+
+				double range = maxValue - minValue;
+				return SampleToFloat(NextSample(), minValue, range);
+			}
+
+			/// <summary>
+			/// Generates random boolean values and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random boolean values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextBooleans(bool* buffer, int length)
+			{
+				NextValues<bool>(buffer, length, BooleanConverter());
+			}
+
+			/// <summary>
+			/// Generates random boolean values with the specified probability of being true and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random boolean values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="percent">The probability of being true, between 0 and 1.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextProbabilities(bool* buffer, int length, float percent)
+			{
+				if (percent >= 1 || percent <= 0)
+				{
+					FillValue<bool>(buffer, length, percent >= 1);
+					return;
+				}
+
+				ProbabilityConverter converter = { percent };
+				NextValues<bool>(buffer, length, converter);
+			}
+
+			/// <summary>
+			/// Generates random boolean values with the specified probability of being true by drawing the gaps between the true values, and stores them in the buffer.
+			/// Probabilities above SparseProbabilityLimit are generated like NextProbabilities.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random boolean values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="percent">The probability of being true, between 0 and 1.</param>
+			void NextSparseProbabilities(bool* buffer, int length, float percent)
+			{
+				if (percent > SparseProbabilityLimit || !(percent > 0))
+				{
+					NextProbabilities(buffer, length, percent);
+					return;
+				}
+
+				GenerateSparseProbabilities(_seedArray, _iNext, _iNextP, buffer, length, percent);
+			}
+
+			/// <summary>
+			/// Writes the indices of the true values of a boolean sequence with the specified probability, drawing the gaps between them.
+			/// </summary>
+			/// <param name="length">The number of values of the sequence.</param>
+			/// <param name="percent">The probability of being true, between 0 and 1.</param>
+			/// <param name="output">The iterator to write the indices to.</param>
+			/// <returns>The iterator past the last written index.</returns>
+			template <typename TOutputIterator>
+			TOutputIterator NextProbabilityIndices(int length, float percent, TOutputIterator output)
+			{
+				if (!(percent > 0))
+					return output;
+
+				if (percent >= 1)
+				{
+					for (int i = 0; i < length; i++)
+						*output++ = i;
+
+					return output;
+				}
+
+				double logFailure = std::log1p(-static_cast<double>(percent));
+
+				for (int i = NextSparseIndex(_seedArray, _iNext, _iNextP, 0, length, logFailure); i < length; i = NextSparseIndex(_seedArray, _iNext, _iNextP, i + 1, length, logFailure))
+				{
+					*output++ = i;
+				}
+
+				return output;
+			}
+
+			/// <summary>
+			/// Generates random byte values within the range [minValue, maxValue] and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random byte values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The maximum value, not less than minValue.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextBytes(unsigned char* buffer, int length, unsigned char minValue, unsigned char maxValue)
+			{
+				if (minValue == maxValue)
+				{
+					FillValue<unsigned char>(buffer, length, minValue);
+					return;
+				}
+
+				ByteConverter converter = { minValue, maxValue + 1 };
+				NextValues<unsigned char>(buffer, length, converter);
+			}
+
+			/// <summary>
+			/// Generates random integers within the range [minValue, maxValue) and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random integers.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The exclusive maximum value, greater than minValue.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextIntegers(int* buffer, int length, int minValue, int maxValue)
+			{
+				if (minValue == maxValue - 1)
+				{
+					FillValue<int>(buffer, length, minValue);
+					return;
+				}
+
+				IntegerConverter converter = { minValue, maxValue };
+				NextValues<int>(buffer, length, converter);
+			}
+
+			/// <summary>
+			/// Generates random integers within the range [minValue, maxValue), every integer being equally likely, and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random integers.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The exclusive maximum value, greater than minValue.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextPreciseIntegers(int* buffer, int length, int minValue, int maxValue)
+			{
+				if (minValue == maxValue - 1)
+				{
+					FillValue<int>(buffer, length, minValue);
+					return;
+				}
+
+				GeneratePreciseValues<int>(_seedArray, _iNext, _iNextP, buffer, length, minValue, maxValue);
+			}
+
+			/// <summary>
+			/// Generates random float values within the range [minValue, maxValue] and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random float values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The maximum value, not less than minValue.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextFloats(float* buffer, int length, float minValue, float maxValue)
+			{
+				if (minValue == maxValue)
+				{
+					FillValue<float>(buffer, length, minValue);
+					return;
+				}
+
+				FloatConverter converter = { minValue, static_cast<double>(maxValue - minValue) };
+				NextValues<float>(buffer, length, converter);
+			}
+
+			/// <summary>
+			/// Generates random 64-bit values, three samples each, and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextUInt64s(unsigned long long* buffer, int length)
+			{
+				GenerateWideValues<unsigned long long>(_seedArray, _iNext, _iNextP, buffer, length, 0, 0);
+			}
+
+			/// <summary>
+			/// Generates random 64-bit integers within the range [minValue, maxValue), every integer being equally likely, and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random integers.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The exclusive maximum value, greater than minValue.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextInt64s(long long* buffer, int length, long long minValue, long long maxValue)
+			{
+				if (minValue == maxValue - 1)
+				{
+					FillValue<long long>(buffer, length, minValue);
+					return;
+				}
+
+				std::uint64_t range = static_cast<std::uint64_t>(maxValue) - static_cast<std::uint64_t>(minValue);
+				GenerateWideValues<long long>(_seedArray, _iNext, _iNextP, buffer, length, static_cast<std::uint64_t>(minValue), range);
+			}
+
+			/// <summary>
+			/// Generates random double values within the range [0, 1), two samples each, and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random double values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextDoubles(double* buffer, int length)
+			{
+				GeneratePairedValues<double>(_seedArray, _iNext, _iNextP, buffer, length, UnitDoubleConverter());
+			}
+
+			/// <summary>
+			/// Generates random double values within the range [minValue, maxValue), two samples each, and stores them in the buffer.
+			/// </summary>
+			/// <param name="buffer">The buffer to store the random double values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="minValue">The minimum value.</param>
+			/// <param name="maxValue">The exclusive maximum value, not less than minValue.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextDoubles(double* buffer, int length, double minValue, double maxValue)
+			{
+				if (minValue == maxValue)
+				{
+					FillValue<double>(buffer, length, minValue);
+					return;
+				}
+
+				DoubleConverter converter = { minValue, maxValue - minValue };
+				GeneratePairedValues<double>(_seedArray, _iNext, _iNextP, buffer, length, converter);
+			}
+
+		private:
+			/// <summary>
+			/// The seed the chaos core was last seeded with.
+			/// </summary>
+			int _seed = 0;
+
+			/// <summary>
+			/// The array to store the seed values.
+			/// </summary>
+			int _seedArray[StateLength] = {};
+
+			/// <summary>
+			/// The index of the next random number.
+			/// </summary>
+			int _iNext = 0;
+
+			/// <summary>
+			/// The index of the next random number for probability calculation.
+			/// </summary>
+			int _iNextP = 0;
+		};
+
+		/// <summary>
+		/// Represents a view over the states of many chaos engines stored together in caller owned memory.
+		/// Slot k of engine e is stored at index k * count + e, so the same slot of every engine is contiguous.
+		/// Only the index of the next sample is stored per engine, since the second index always trails it by InitialNextP slots.
+		/// Every engine produces the same sequence as a ChaosCore in the same state.
+		/// Arguments are not validated; engine indices must be within the range [0, count).
+		/// </summary>
+		class ChaosPoolCore
+		{
+		public:
+			/// <summary>
+			/// Initializes a new instance of the ChaosPoolCore class over the specified memory.
+			/// </summary>
+			/// <param name="states">The seed arrays of the engines, StateLength * count values.</param>
+			/// <param name="indices">The indices of the next sample of the engines, count values.</param>
+			/// <param name="count">The number of engines.</param>
+			constexpr ChaosPoolCore(int* states, unsigned char* indices, int count) : _states(states), _indices(indices), _count(count)
+			{
+			}
+
+			/// <summary>
+			/// Gets the number of engines in the pool.
+			/// </summary>
+			constexpr int Count() const
+			{
+				return _count;
+			}
+
+			/// <summary>
+			/// Reseeds an engine with the specified seed.
+			/// </summary>
+			/// <param name="engine">The index of the engine.</param>
+			/// <param name="seed">The seed value.</param>
+			constexpr void Reseed(int engine, int seed)
+			{
+				int seedArray[StateLength] = {};
+				int iNext = 0;
+				int iNextP = 0;
+
+				ReseedState(seedArray, iNext, iNextP, seed);
+				StoreState(engine, seedArray, iNext);
+			}
+
+			/// <summary>
+			/// Generates the next random sample of an engine.
+			/// </summary>
+			/// <param name="engine">The index of the engine.</param>
+			/// <returns>A random sample.</returns>
+			constexpr int NextSample(int engine)
+			{
+				int iNext = _indices[engine];
+				int iNextP = iNext + InitialNextP >= StateLength ? iNext + InitialNextP - StateLength : iNext + InitialNextP;
+				int* next = _states + static_cast<std::size_t>(iNext) * _count + engine;
+
+				int retVal = SubtractSamples(*next, _states[static_cast<std::size_t>(iNextP) * _count + engine]);
+				*next = retVal;
+
+				_indices[engine] = static_cast<unsigned char>(iNext + 1 >= StateLength ? 0 : iNext + 1);
+				return retVal;
+			}
+
+			/// <summary>
+			/// Generates the next random sample of every engine in a range and stores them in the buffer, in engine order.
+			/// Each run of engines at the same position in their sequences is advanced with one vector sweep across the engines.
+			/// Every engine produces exactly the sample NextSample would.
+			/// </summary>
+			/// <param name="first">The index of the first engine.</param>
+			/// <param name="count">The number of engines.</param>
+			/// <param name="buffer">The buffer to store the random samples.</param>
+			AURORA_CHAOS_CONSTEXPR20 void NextSamples(int first, int count, int* buffer)
+			{
+#if defined(__cpp_lib_is_constant_evaluated)
+				if (std::is_constant_evaluated())
+				{
+					for (int i = 0; i < count; i++)
+					{
+						buffer[i] = NextSample(first + i);
+					}
+
+					return;
+				}
+#endif
+
+				int end = first + count;
+
+				for (int start = first; start < end;)
+				{
+					unsigned char iNext = _indices[start];
+					int stop = start + 1;
+
+					while (stop < end && _indices[stop] == iNext)
+					{
+						stop++;
+					}
+
+					int iNextP = iNext + InitialNextP >= StateLength ? iNext + InitialNextP - StateLength : iNext + InitialNextP;
+					int* oldest = _states + static_cast<std::size_t>(iNext) * _count + start;
+					const int* recent = _states + static_cast<std::size_t>(iNextP) * _count + start;
+
+					SubtractRowsFast(oldest, recent, buffer + (start - first), stop - start);
+					std::memset(_indices + start, iNext + 1 >= StateLength ? 0 : iNext + 1, stop - start);
+
+					start = stop;
+				}
+			}
+
+			/// <summary>
+			/// Converts the next random sample of every engine in a range into a value and stores the values in the buffer, in engine order.
+			/// </summary>
+			/// <param name="first">The index of the first engine.</param>
+			/// <param name="count">The number of engines.</param>
+			/// <param name="buffer">The buffer to store the values.</param>
+			/// <param name="converter">The function converting a sample into a value.</param>
+			template <typename T, typename TConverter>
+			AURORA_CHAOS_CONSTEXPR20 void NextValues(int first, int count, T* buffer, TConverter converter)
+			{
+				int samples[SampleChunk];
+
+				for (int offset = 0; offset < count; offset += SampleChunk)
+				{
+					int chunk = count - offset < SampleChunk ? count - offset : SampleChunk;
+					NextSamples(first + offset, chunk, samples);
+
+					for (int i = 0; i < chunk; i++)
+					{
+						buffer[offset + i] = converter(samples[i]);
+					}
+				}
+			}
+
+			/// <summary>
+			/// Writes the state of an engine to a buffer of SavedStateSize bytes, in the layout of ChaosCore::SaveState.
+			/// </summary>
+			/// <param name="engine">The index of the engine.</param>
+			/// <param name="buffer">The buffer to write the state to.</param>
+			/// <param name="seed">The seed to record for the engine.</param>
+			constexpr void SaveState(int engine, unsigned char* buffer, int seed) const
+			{
+				int seedArray[StateLength] = {};
+				CopySeedArray(engine, seedArray);
+				Native::SaveState(buffer, seedArray, _indices[engine], seed, 0);
+			}
+
+			/// <summary>
+			/// Restores the state of an engine from a state written by SaveState; the recorded seed and number of parallel fills are not kept.
+			/// </summary>
+			/// <param name="engine">The index of the engine.</param>
+			/// <param name="buffer">The buffer of SavedStateSize bytes holding the state.</param>
+			/// <returns>true if the state was restored; false if the buffer does not hold a valid state.</returns>
+			constexpr bool LoadState(int engine, const unsigned char* buffer)
+			{
+				int seedArray[StateLength] = {};
+				int iNext = 0;
+				int iNextP = 0;
+				int seed = 0;
+				std::uint32_t parallelFills = 0;
+
+				if (!Native::LoadState(buffer, seedArray, iNext, iNextP, seed, parallelFills))
+					return false;
+
+				StoreState(engine, seedArray, iNext);
+				return true;
+			}
+
+		private:
+			/// <summary>
+			/// Copies the seed array of an engine out of the pool.
+			/// </summary>
+			constexpr void CopySeedArray(int engine, int* seedArray) const
+			{
+				for (int k = 0; k < StateLength; k++)
+				{
+					seedArray[k] = _states[static_cast<std::size_t>(k) * _count + engine];
+				}
+			}
+
+			/// <summary>
+			/// Copies a seed array and its index into the state of an engine.
+			/// </summary>
+			constexpr void StoreState(int engine, const int* seedArray, int iNext)
+			{
+				for (int k = 0; k < StateLength; k++)
+				{
+					_states[static_cast<std::size_t>(k) * _count + engine] = seedArray[k];
+				}
+
+				_indices[engine] = static_cast<unsigned char>(iNext);
+			}
+
+			/// <summary>
+			/// The seed arrays of the engines.
+			/// </summary>
+			int* _states;
+
+			/// <summary>
+			/// The indices of the next sample of the engines.
+			/// </summary>
+			unsigned char* _indices;
+
+			/// <summary>
+			/// The number of engines.
+			/// </summary>
+			int _count;
+		};
+
+		/// <summary>
+		/// The block of four words produced by one evaluation of the Philox function.
+		/// </summary>
+		struct PhiloxBlock
+		{
+			std::uint32_t Words[4];
+		};
+
+		/// <summary>
+		/// Evaluates the Philox4x32-10 bijection of a counter under a key.
+		/// </summary>
+		constexpr PhiloxBlock Philox4x32(std::uint32_t counter0, std::uint32_t counter1, std::uint32_t counter2, std::uint32_t counter3, std::uint32_t key0, std::uint32_t key1)
+		{
+			PhiloxBlock block = { { counter0, counter1, counter2, counter3 } };
+
+			for (int round = 0; round < 10; round++)
+			{
+				if (round > 0)
+				{
+					key0 += 0x9E3779B9u;
+					key1 += 0xBB67AE85u;
+				}
+
+				std::uint64_t product0 = static_cast<std::uint64_t>(0xD2511F53u) * block.Words[0];
+				std::uint64_t product1 = static_cast<std::uint64_t>(0xCD9E8D57u) * block.Words[2];
+
+				std::uint32_t word0 = static_cast<std::uint32_t>(product1 >> 32) ^ block.Words[1] ^ key0;
+				std::uint32_t word2 = static_cast<std::uint32_t>(product0 >> 32) ^ block.Words[3] ^ key1;
+
+				block.Words[0] = word0;
+				block.Words[1] = static_cast<std::uint32_t>(product1);
+				block.Words[2] = word2;
+				block.Words[3] = static_cast<std::uint32_t>(product0);
+			}
+
+			return block;
+		}
+
+		/// <summary>
+		/// Represents a stateless generator whose samples are a function of the seed and their index.
+		/// Any sample can be computed on its own, so a stream can be split across threads without changing its values.
+		/// Every group of four consecutive samples comes from one Philox4x32-10 block keyed by the seed.
+		/// </summary>
+		class ChaosCounterCore
+		{
+		public:
+			/// <summary>
+			/// Initializes a new instance of the ChaosCounterCore class with the specified seed.
+			/// </summary>
+			/// <param name="seed">The seed value.</param>
+			constexpr explicit ChaosCounterCore(int seed) : _key0(static_cast<std::uint32_t>(seed)), _key1(static_cast<std::uint32_t>(InternalSeed))
+			{
+			}
+
+			/// <summary>
+			/// Gets the sample at the specified index.
+			/// </summary>
+			/// <param name="index">The index of the sample.</param>
+			/// <returns>A random sample within the range [0, 2147483647].</returns>
+			constexpr int SampleAt(unsigned long long index) const
+			{
+				PhiloxBlock block = BlockAt(index >> 2);
+				return static_cast<int>(block.Words[index & 3] >> 1);
+			}
+
+			/// <summary>
+			/// Writes the samples starting at the specified index into the buffer.
+			/// </summary>
+			/// <param name="startIndex">The index of the first sample.</param>
+			/// <param name="buffer">The buffer to store the samples.</param>
+			/// <param name="count">The number of samples to write.</param>
+			constexpr void Fill(unsigned long long startIndex, int* buffer, int count) const
+			{
+				int written = 0;
+
+				while (written < count)
+				{
+					unsigned long long index = startIndex + written;
+					PhiloxBlock block = BlockAt(index >> 2);
+
+					for (int word = static_cast<int>(index & 3); word < 4 && written < count; word++)
+					{
+						buffer[written++] = static_cast<int>(block.Words[word] >> 1);
+					}
+				}
+			}
+
+			/// <summary>
+			/// Converts the samples starting at the specified index into values and stores them in the buffer.
+			/// </summary>
+			/// <param name="startIndex">The index of the first sample.</param>
+			/// <param name="buffer">The buffer to store the values.</param>
+			/// <param name="length">The number of values to generate.</param>
+			/// <param name="converter">The function converting a sample into a value.</param>
+			template <typename T, typename TConverter>
+			AURORA_CHAOS_CONSTEXPR20 void FillValues(unsigned long long startIndex, T* buffer, int length, TConverter converter) const
+			{
+				int samples[SampleChunk];
+
+				for (int offset = 0; offset < length; offset += SampleChunk)
+				{
+					int count = length - offset < SampleChunk ? length - offset : SampleChunk;
+					Fill(startIndex + offset, samples, count);
+
+					for (int i = 0; i < count; i++)
+					{
+						buffer[offset + i] = converter(samples[i]);
+					}
+				}
+			}
+
+		private:
+			/// <summary>
+			/// Evaluates the Philox block at the specified block index.
+			/// </summary>
+			constexpr PhiloxBlock BlockAt(unsigned long long blockIndex) const
+			{
+				return Philox4x32(static_cast<std::uint32_t>(blockIndex), static_cast<std::uint32_t>(blockIndex >> 32), 0, 0, _key0, _key1);
+			}
+
+			/// <summary>
+			/// The first word of the Philox key.
+			/// </summary>
+			std::uint32_t _key0;
+
+			/// <summary>
+			/// The second word of the Philox key.
+			/// </summary>
+			std::uint32_t _key1;
+		};
+
+		/// <summary>
+		/// Generates the first samples of the sequence for a seed, for example to bake a fixed table into a binary at compile time.
+		/// </summary>
+		/// <typeparam name="Count">The number of samples to generate.</typeparam>
+		/// <param name="seed">The seed value.</param>
+		/// <returns>The generated samples.</returns>
+		template <std::size_t Count>
+		constexpr std::array<int, Count> GenerateSampleTable(int seed)
+		{
+			ChaosCore core(seed);
+			std::array<int, Count> samples = {};
+
+			for (std::size_t i = 0; i < Count; i++)
+			{
+				samples[i] = core.NextSample();
+			}
+
+			return samples;
+		}
+
+#if defined(__cpp_lib_concepts)
+		static_assert(std::uniform_random_bit_generator<ChaosCore>, "ChaosCore must be usable with the standard distributions.");
+#endif
+	}
+}
@@ -0,0 +1,74 @@
+#include "ChaosCore.h"
+
+#include <cstdio>
+#include <limits>
+
+using namespace Aurora::Native;
+
+namespace
+{
+	const int Seeds[] = { 0, 1, 42, -7, 987654 };
+	const int Draws = 100000;
+
+	/// <summary>
+	/// Checks that a draw picked an outcome with a weight greater than zero.
+	/// </summary>
+	bool CheckIndex(const char* name, int seed, const int* cumulativeWeights, int count, int index)
+	{
+		int weight = index < count ? cumulativeWeights[index] - (index > 0 ? cumulativeWeights[index - 1] : 0) : 0;
+
+		if (weight > 0)
+			return true;
+
+		std::printf("%s: seed %d picked index %d of %d\n", name, seed, index, count);
+		return false;
+	}
+
+	/// <summary>
+	/// Draws weighted indices one at a time and in bulk, as NextEnum and Choose do, for every seed.
+	/// </summary>
+	bool TestWeights(const char* name, const int* cumulativeWeights, int count)
+	{
+		ScaledIntegerConverter converter = { 0, cumulativeWeights[count - 1] };
+		int indices[SampleChunk];
+
+		for (int seed : Seeds)
+		{
+			ChaosCore core(seed);
+
+			for (int i = 0; i < Draws; i++)
+			{
+				if (!CheckIndex(name, seed, cumulativeWeights, count, core.NextWeightedIndex(cumulativeWeights, count)))
+					return false;
+			}
+
+			for (int offset = 0; offset < Draws; offset += SampleChunk)
+			{
+				core.NextValues<int>(indices, SampleChunk, converter);
+
+				for (int i = 0; i < SampleChunk; i++)
+				{
+					if (!CheckIndex(name, seed, cumulativeWeights, count, FindWeightedIndex(cumulativeWeights, count, indices[i])))
+						return false;
+				}
+			}
+		}
+
+		return true;
+	}
+}
+
+int main()
+{
+	const int single[] = { 1 };
+	const int skewed[] = { 1, 1, 4, 5 };
+	const int trailing[] = { 3, 3, 3, 10, 10 };
+	const int heavy[] = { 1, std::numeric_limits<int>::max() - 1, std::numeric_limits<int>::max() };
+
+	bool passed = TestWeights("single", single, 1);
+	passed = TestWeights("skewed", skewed, 4) && passed;
+	passed = TestWeights("trailing", trailing, 5) && passed;
+	passed = TestWeights("heavy", heavy, 3) && passed;
+
+	return passed ? 0 : 1;
+}